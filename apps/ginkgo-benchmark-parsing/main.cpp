@@ -0,0 +1,139 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+#include <boost/program_options.hpp>
+
+#include <ginkgo/solving/Constraint.h>
+#include <ginkgo/solving/SymbolTable.h>
+#include <ginkgo/utils/LineQueue.h>
+
+// Generates constraints in the format logged by xclasp
+std::string generateConstraints(size_t numberOfConstraints)
+{
+	std::mt19937 generator(0);
+	std::uniform_int_distribution<size_t> numberOfLiterals(2, 12);
+	std::uniform_int_distribution<size_t> object(0, 49);
+	std::uniform_int_distribution<size_t> time(0, 30);
+	std::uniform_int_distribution<size_t> lbd(1, 20);
+	std::bernoulli_distribution coin(0.5);
+
+	std::stringstream constraints;
+
+	for (size_t i = 0; i < numberOfConstraints; i++)
+	{
+		constraints << ":- ";
+
+		const auto literals = numberOfLiterals(generator);
+
+		for (size_t j = 0; j < literals; j++)
+		{
+			if (j > 0)
+				constraints << ", ";
+
+			if (coin(generator))
+				constraints << "not ";
+
+			if (coin(generator))
+				constraints << "holds(on(b" << object(generator) << ",b" << object(generator) << ")," << time(generator) << ")";
+			else
+				constraints << "apply(move(b" << object(generator) << ",b" << object(generator) << ",b" << object(generator) << ")," << time(generator) << ")";
+		}
+
+		constraints << ".  %lbd = " << lbd(generator) << std::endl;
+	}
+
+	return constraints.str();
+}
+
+int main(int argc, char **argv)
+{
+	namespace po = boost::program_options;
+
+	po::options_description description("Allowed options");
+	description.add_options()
+		("help,h", "display this help message")
+		("file,f", po::value<std::string>(), "File with one logged constraint per line (generated if unspecified)")
+		("constraints", po::value<size_t>()->default_value(100000), "Number of generated constraints")
+		("repetitions", po::value<size_t>()->default_value(5), "Number of times the constraints are parsed")
+		("chunk-size", po::value<size_t>()->default_value(64 * 1024), "Size of the chunks passed to the line queue");
+
+	po::variables_map variablesMap;
+	po::store(po::parse_command_line(argc, argv, description), variablesMap);
+	po::notify(variablesMap);
+
+	if (variablesMap.count("help"))
+	{
+		std::cout << description;
+		return EXIT_SUCCESS;
+	}
+
+	std::string input;
+
+	if (variablesMap.count("file"))
+	{
+		std::ifstream file(variablesMap["file"].as<std::string>(), std::ios::in);
+
+		if (!file.is_open())
+		{
+			std::cerr << "[Error] Could not open constraints file" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		input = buffer.str();
+	}
+	else
+		input = generateConstraints(variablesMap["constraints"].as<size_t>());
+
+	const auto repetitions = variablesMap["repetitions"].as<size_t>();
+	const auto chunkSize = std::max<size_t>(variablesMap["chunk-size"].as<size_t>(), 1);
+
+	size_t numberOfConstraints = 0;
+	size_t numberOfLiterals = 0;
+	double parsingTime = 0.0;
+
+	for (size_t i = 0; i < repetitions; i++)
+	{
+		// Each repetition interns its identifiers from scratch, just like a new extraction would
+		ginkgo::SymbolTable symbolTable;
+		ginkgo::LineQueue lineQueue;
+		boost::string_ref line;
+
+		const auto startTime = std::chrono::high_resolution_clock::now();
+
+		// Lines are passed in chunks, like the output read from xclasp
+		for (size_t position = 0; position < input.size(); position += chunkSize)
+		{
+			lineQueue.append(input.data() + position, std::min(chunkSize, input.size() - position));
+
+			if (position + chunkSize >= input.size())
+				lineQueue.flush();
+
+			while (lineQueue.pop(line))
+			{
+				if (line.empty())
+					continue;
+
+				const ginkgo::Constraint constraint(numberOfConstraints, line, symbolTable);
+
+				numberOfConstraints++;
+				numberOfLiterals += constraint.numberOfLiterals();
+			}
+		}
+
+		parsingTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+	}
+
+	const auto megabytes = static_cast<double>(input.size() * repetitions) / (1024.0 * 1024.0);
+
+	std::cout << "[Info ] Parsed " << numberOfConstraints << " constraints (" << numberOfLiterals << " literals, "
+		<< megabytes << " MB) in " << parsingTime << " seconds" << std::endl;
+	std::cout << "[Info ] " << (numberOfConstraints / parsingTime) << " constraints/sec, "
+		<< (megabytes / parsingTime) << " MB/sec" << std::endl;
+
+	return EXIT_SUCCESS;
+}
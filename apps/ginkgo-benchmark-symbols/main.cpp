@@ -0,0 +1,81 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <ginkgo/solving/SymbolTable.h>
+
+// Generates distinct identifiers resembling the objects and time steps of logged constraints
+std::vector<std::string> generateIdentifiers(size_t numberOfIdentifiers)
+{
+	std::vector<std::string> identifiers;
+	identifiers.reserve(numberOfIdentifiers);
+
+	for (size_t i = 0; i < numberOfIdentifiers; i++)
+		identifiers.push_back((i % 2 == 0) ? std::to_string(i / 2) : "b" + std::to_string(i / 2));
+
+	return identifiers;
+}
+
+int main(int argc, char **argv)
+{
+	namespace po = boost::program_options;
+
+	po::options_description description("Allowed options");
+	description.add_options()
+		("help,h", "display this help message")
+		("max-symbols", po::value<size_t>()->default_value(1000000), "Size of the largest symbol table")
+		("lookups", po::value<size_t>()->default_value(10000000), "Number of lookups per symbol table size");
+
+	po::variables_map variablesMap;
+	po::store(po::parse_command_line(argc, argv, description), variablesMap);
+	po::notify(variablesMap);
+
+	if (variablesMap.count("help"))
+	{
+		std::cout << description;
+		return EXIT_SUCCESS;
+	}
+
+	const auto maxSymbols = variablesMap["max-symbols"].as<size_t>();
+	const auto lookups = variablesMap["lookups"].as<size_t>();
+
+	const auto identifiers = generateIdentifiers(maxSymbols);
+
+	ginkgo::SymbolTable symbolTable;
+	std::mt19937 generator(0);
+	size_t checksum = 0;
+
+	// Lookups of known identifiers should cost the same regardless of the number of symbols
+	for (size_t numberOfSymbols = 1000; numberOfSymbols <= maxSymbols; numberOfSymbols *= 10)
+	{
+		for (size_t i = symbolTable.size(); i < numberOfSymbols; i++)
+			symbolTable.symbol(identifiers[i]);
+
+		std::uniform_int_distribution<size_t> identifier(0, numberOfSymbols - 1);
+
+		std::vector<size_t> indices(std::min<size_t>(lookups, 1 << 20));
+
+		for (auto &index : indices)
+			index = identifier(generator);
+
+		const auto startTime = std::chrono::high_resolution_clock::now();
+
+		for (size_t i = 0; i < lookups; i++)
+			checksum += symbolTable.symbol(identifiers[indices[i % indices.size()]]);
+
+		const auto lookupTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+		std::cout << "[Info ] " << numberOfSymbols << " symbols: " << (lookupTime * 1e9 / lookups)
+			<< " ns/lookup" << std::endl;
+	}
+
+	// Keeps the lookups from being optimized away
+	if (checksum == 0)
+		std::cout << "[Info ] Checksum " << checksum << std::endl;
+
+	return EXIT_SUCCESS;
+}
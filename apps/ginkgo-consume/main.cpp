@@ -22,7 +22,8 @@ int main(int argc, char **argv)
 		("feedback-type", po::value<ginkgo::feedbackLoop::consumption::FeedbackType>(), "Feedback type (Direct, Generalized)")
 		("horizon", po::value<size_t>(), "Horizon (maximum time steps)")
 		("max-constraints", po::value<size_t>(), "Maximum number of constraints to test")
-		("time-limit", po::value<size_t>(), "Time limit per clasp execution in seconds");
+		("time-limit", po::value<size_t>(), "Time limit per clasp execution in seconds")
+		("pipeline", po::value<bool>()->default_value(false), "Pipe gringo's output directly into clasp");
 
 	po::variables_map variablesMap;
 	po::store(po::parse_command_line(argc, argv, description), variablesMap);
@@ -71,6 +72,7 @@ int main(int argc, char **argv)
 	benchmarkEnvironment->setFeedbackType(variablesMap["feedback-type"].as<ginkgo::feedbackLoop::consumption::FeedbackType>());
 	benchmarkEnvironment->setHorizon(variablesMap["horizon"].as<size_t>());
 	benchmarkEnvironment->setMaxNumberOfConstraints(variablesMap["max-constraints"].as<size_t>());
+	benchmarkEnvironment->setPipelining(variablesMap["pipeline"].as<bool>());
 
 	ginkgo::feedbackLoop::consumption::BenchmarkRunner(std::move(benchmarkEnvironment)).run();
 
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <algorithm>
 
 #include <boost/program_options.hpp>
 
@@ -26,10 +27,22 @@ int main(int argc, char **argv)
 		("xclasp,x", po::value<std::string>(), "xclasp binary (clasp with extensions for knowledge extraction)")
 		("gringo,g", po::value<std::string>(), "gringo binary")
 		("horizon", po::value<size_t>(), "Horizon (maximum time steps)")
-		("proof-method", po::value<ginkgo::feedbackLoop::production::ProofMethod>(), "Proof method to use (StateWise, Induction)")
+		("proof-method", po::value<ginkgo::feedbackLoop::production::ProofMethod>(), "Proof method to use (StateWiseProof, InductionProof, Portfolio)")
 		("testing-policy", po::value<ginkgo::feedbackLoop::production::TestingPolicy>(), "Feedback constraint Testing policy (FindFirst, TestAll)")
-		("minimization-strategy", po::value<ginkgo::feedbackLoop::production::MinimizationStrategy>(), "Clause minimization strategy (NoMinimization, SimpleMinimization, LinearMinimization)")
+		("minimization-strategy", po::value<ginkgo::feedbackLoop::production::MinimizationStrategy>(), "Clause minimization strategy (NoMinimization, SimpleMinimization, LinearMinimization, QuickXplainMinimization, UnsatCoreMinimization)")
 		("fluent-closure-usage", po::value<ginkgo::feedbackLoop::production::FluentClosureUsage>(), "Usage of fluent closure (NoFluentClosure, UseFluentClosure)")
+		("solver-backend", po::value<ginkgo::feedbackLoop::production::SolverBackend>()->default_value(ginkgo::feedbackLoop::production::SolverBackend::Process), "Backend for testing hypotheses (Process = gringo and clasp binaries, Clingo = clingo library, ClingoIncremental = multi-shot clingo sessions)")
+		("pipeline-processes", po::value<bool>()->default_value(false), "Pipe gringo's output directly into clasp (with the Process backend only)")
+		("proof-workers", po::value<size_t>()->default_value(1), "Test up to <n> hypotheses concurrently (TestAll only)")
+		("speculative-minimization", po::value<size_t>()->default_value(1), "Test up to <n> minimization candidates concurrently and combine the successful ones")
+		("proof-batch-size", po::value<size_t>()->default_value(16), "Ground up to <n> hypotheses of equal degree at once (ClingoIncremental only)")
+		("preground-transition-systems", po::value<bool>()->default_value(false), "Ground the transition system only once per proof type and degree and append each proof to it (Process only)")
+		("keep-counterexamples", po::value<bool>()->default_value(false), "Keep the models of unsuccessful proofs to refute later hypotheses without solving")
+		("reduce-program", po::value<bool>()->default_value(false), "Remove unreachable actions and fluents and static demands from the instance")
+		("precompute-fluent-closure", po::value<bool>()->default_value(false), "Compute the fluent closure only once (with fluent closure usage only)")
+		("simulated-walks", po::value<size_t>()->default_value(0), "Refute hypotheses with <n> simulated walks before proving them (0 = no simulation)")
+		("explicit-state-checking", po::value<ginkgo::feedbackLoop::production::ExplicitStateChecking>()->default_value(ginkgo::feedbackLoop::production::ExplicitStateChecking::NoExplicitStateChecking), "Decide state-wise proofs of degree 0 and 1 without solving (NoExplicitStateChecking, UseExplicitStateChecking, CrossCheckExplicitStateChecking)")
+		("explicit-state-bound", po::value<size_t>()->default_value(65536), "Prove with the solver if the explicit-state checker would enumerate more than <n> states and transitions")
 		("constraints-to-extract", po::value<size_t>(), "Extract <n> constraints")
 		("constraints-to-prove", po::value<size_t>(), "Finish after <n> proven constraints")
 		("max-degree", po::value<size_t>(), "Maximum degree of hypotheses to test")
@@ -84,6 +97,18 @@ int main(int argc, char **argv)
 		exit(EXIT_FAILURE);
 	}
 
+	const auto proofMethod = variablesMap["proof-method"].as<ginkgo::feedbackLoop::production::ProofMethod>();
+	const auto solverBackend = variablesMap["solver-backend"].as<ginkgo::feedbackLoop::production::SolverBackend>();
+
+	// Proof sessions cannot race, as interrupting one would abort all its future proofs
+	if (proofMethod == ginkgo::feedbackLoop::production::ProofMethod::Portfolio
+		&& solverBackend == ginkgo::feedbackLoop::production::SolverBackend::ClingoIncremental)
+	{
+		std::cerr << "[Error] Proof method Portfolio not supported with solver backend ClingoIncremental" << std::endl;
+		std::cout << description;
+		exit(EXIT_FAILURE);
+	}
+
 	// Feedback loop environment
 	ginkgo::AsyncProcess::Configuration claspConfiguration =
 	{
@@ -113,10 +138,22 @@ int main(int argc, char **argv)
 
 	auto configuration = std::make_unique<ginkgo::feedbackLoop::production::Configuration<ginkgo::Plain>>();
 	configuration->horizon = variablesMap["horizon"].as<size_t>();
-	configuration->proofMethod = variablesMap["proof-method"].as<ginkgo::feedbackLoop::production::ProofMethod>();
+	configuration->proofMethod = proofMethod;
 	configuration->testingPolicy = variablesMap["testing-policy"].as<ginkgo::feedbackLoop::production::TestingPolicy>();
 	configuration->minimizationStrategy = variablesMap["minimization-strategy"].as<ginkgo::feedbackLoop::production::MinimizationStrategy>();
 	configuration->fluentClosureUsage = variablesMap["fluent-closure-usage"].as<ginkgo::feedbackLoop::production::FluentClosureUsage>();
+	configuration->solverBackend = solverBackend;
+	configuration->pipelineProcesses = variablesMap["pipeline-processes"].as<bool>();
+	configuration->proofWorkers = std::max<size_t>(1, variablesMap["proof-workers"].as<size_t>());
+	configuration->speculativeMinimizationCandidates = std::max<size_t>(1, variablesMap["speculative-minimization"].as<size_t>());
+	configuration->proofBatchSize = std::max<size_t>(1, variablesMap["proof-batch-size"].as<size_t>());
+	configuration->pregroundTransitionSystems = variablesMap["preground-transition-systems"].as<bool>();
+	configuration->keepCounterexamples = variablesMap["keep-counterexamples"].as<bool>();
+	configuration->reduceProgram = variablesMap["reduce-program"].as<bool>();
+	configuration->precomputeFluentClosure = variablesMap["precompute-fluent-closure"].as<bool>();
+	configuration->simulatedWalks = variablesMap["simulated-walks"].as<size_t>();
+	configuration->explicitStateChecking = variablesMap["explicit-state-checking"].as<ginkgo::feedbackLoop::production::ExplicitStateChecking>();
+	configuration->explicitStateBound = variablesMap["explicit-state-bound"].as<size_t>();
 	configuration->constraintsToExtract = variablesMap["constraints-to-extract"].as<size_t>();
 	configuration->constraintsToProve = variablesMap["constraints-to-prove"].as<size_t>();
 	configuration->maxDegree = variablesMap["max-degree"].as<size_t>();
@@ -1,6 +1,8 @@
 #ifndef __FEEDBACK_LOOP__ANALYSIS__PRODUCTION_ANALYSIS_H
 #define __FEEDBACK_LOOP__ANALYSIS__PRODUCTION_ANALYSIS_H
 
+#include <map>
+
 #include <boost/filesystem.hpp>
 
 #include <ginkgo/feedback-loop/production/Events.h>
@@ -37,6 +39,29 @@ struct ProductionAnalysisBase
 	// Total time spent solving while testing hypotheses
 	typename S<double>::Numerical proofTimeSolvingTotal;
 
+	// Number of hypothesis tests answered by the proof cache
+	typename S<size_t>::Numerical proofCacheHits;
+	// Number of hypothesis tests that had to be proven because no cached result was available
+	typename S<size_t>::Numerical proofCacheMisses;
+	// Number of hypothesis tests answered by counterexamples of earlier unsuccessful proofs
+	typename S<size_t>::Numerical counterexampleRefutations;
+	// Number of hypotheses refuted by simulated traces before testing them
+	typename S<size_t>::Numerical simulationRefutations;
+	typename S<double>::Numerical simulationTimeTotal;
+	// Number of hypothesis tests decided by the explicit-state checker
+	typename S<size_t>::Numerical explicitStateChecks;
+	typename S<double>::Numerical explicitStateCheckTimeTotal;
+	// Fraction of the instance and domain facts kept by the relevance analysis
+	typename S<double>::Numerical programReduction;
+	// Whether the fluent closure was computed once instead of with every proof
+	typename S<bool>::Numerical fluentClosurePrecomputed;
+	typename S<double>::Numerical fluentClosurePrecomputationTime;
+
+	// Number of hypotheses proven first by the state-wise proof with the portfolio proof method
+	typename S<size_t>::Numerical portfolioWinsStateWise;
+	// Number of hypotheses proven first by the induction proof with the portfolio proof method
+	typename S<size_t>::Numerical portfolioWinsInduction;
+
 	// Total number of performed minimization proofs
 	typename S<size_t>::Numerical minimizationProofs;
 	// Number of successful minimization proofs
@@ -52,6 +77,8 @@ struct ProductionAnalysisBase
 	typename S<size_t>::Numerical minimizationLiteralsRemoved;
 	// Total number of proofs required to minimize hypotheses
 	typename S<size_t>::Numerical minimizationTests;
+	// Total number of speculative minimization proofs whose results were discarded
+	typename S<size_t>::Numerical minimizationSpeculativeTests;
 
 	// Minimum degree of a tested hypothesis
 	typename S<size_t>::Numerical hypothesisDegreeMin;
@@ -115,6 +142,9 @@ struct ProductionAnalysis<Plain> : public ProductionAnalysisBase<Plain>
 
 	const boost::filesystem::path &instance() const;
 	const boost::filesystem::path &domain() const;
+
+	// Winning proof methods of the portfolio by hypothesis degree
+	std::map<size_t, std::map<production::ProofMethod, size_t>> portfolioWinsPerDegree;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +173,20 @@ ProductionAnalysis<Aggregated> ProductionAnalysis<Aggregated>::aggregate(
 	aggregatedAnalysis.proofTimeGroundingTotal.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).proofTimeGroundingTotal;}, selector);
 	aggregatedAnalysis.proofTimeSolvingTotal.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).proofTimeSolvingTotal;}, selector);
 
+	aggregatedAnalysis.proofCacheHits.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).proofCacheHits;}, selector);
+	aggregatedAnalysis.proofCacheMisses.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).proofCacheMisses;}, selector);
+	aggregatedAnalysis.counterexampleRefutations.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).counterexampleRefutations;}, selector);
+	aggregatedAnalysis.simulationRefutations.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).simulationRefutations;}, selector);
+	aggregatedAnalysis.simulationTimeTotal.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).simulationTimeTotal;}, selector);
+	aggregatedAnalysis.explicitStateChecks.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).explicitStateChecks;}, selector);
+	aggregatedAnalysis.explicitStateCheckTimeTotal.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).explicitStateCheckTimeTotal;}, selector);
+	aggregatedAnalysis.programReduction.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).programReduction;}, selector);
+	aggregatedAnalysis.fluentClosurePrecomputed.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).fluentClosurePrecomputed;}, selector);
+	aggregatedAnalysis.fluentClosurePrecomputationTime.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).fluentClosurePrecomputationTime;}, selector);
+
+	aggregatedAnalysis.portfolioWinsStateWise.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).portfolioWinsStateWise;}, selector);
+	aggregatedAnalysis.portfolioWinsInduction.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).portfolioWinsInduction;}, selector);
+
 	aggregatedAnalysis.minimizationProofs.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).minimizationProofs;}, selector);
 	aggregatedAnalysis.minimizationProofsSuccessful.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).minimizationProofsSuccessful;}, selector);
 	aggregatedAnalysis.minimizationProofTimeGroundingTotal.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).minimizationProofTimeGroundingTotal;}, selector);
@@ -171,6 +215,7 @@ ProductionAnalysis<Aggregated> ProductionAnalysis<Aggregated>::aggregate(
 	aggregatedAnalysis.feedbackExtractionRestarts.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).feedbackExtractionRestarts;}, selector);
 
 	aggregatedAnalysis.minimizationTests.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).minimizationTests;}, selector);
+	aggregatedAnalysis.minimizationSpeculativeTests.aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).minimizationSpeculativeTests;}, selector);
 
 	aggregatedAnalysis.configuration = production::Configuration<Aggregated>::aggregate(plainAnalyses, [&](const auto &e) {return accessor(e).configuration;}, selector);
 
@@ -43,6 +43,10 @@ class BenchmarkEnvironment
 		void setMaxNumberOfConstraints(size_t maxNumberOfConstraints);
 		size_t maxNumberOfConstraints() const;
 
+		// Whether gringo's output is piped directly into clasp
+		void setPipelining(bool pipelining);
+		bool pipelining() const;
+
 		std::ifstream &constraintsStream();
 		std::ifstream &productionStatisticsStream();
 		std::ofstream &consumptionStatisticsStream();
@@ -56,6 +60,7 @@ class BenchmarkEnvironment
 		FeedbackType m_feedbackType;
 		size_t m_horizon;
 		size_t m_maxNumberOfConstraints;
+		bool m_pipelining;
 
 		std::ifstream m_constraintsStream;
 		std::ifstream m_productionStatisticsStream;
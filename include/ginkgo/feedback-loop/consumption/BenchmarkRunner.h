@@ -27,6 +27,8 @@ class BenchmarkRunner
 		void run();
 
 	private:
+		void reduceProgram();
+
 		std::vector<std::string> m_constraints;
 		std::stringstream m_program;
 
@@ -34,6 +36,9 @@ class BenchmarkRunner
 
 		production::Configuration<Plain> m_productionConfiguration;
 		production::Events m_productionEvents;
+
+		// Fraction of the instance and domain facts kept by the relevance analysis
+		double m_programReduction;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
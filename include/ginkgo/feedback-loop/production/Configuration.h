@@ -11,6 +11,8 @@
 #include <ginkgo/feedback-loop/production/TestingPolicy.h>
 #include <ginkgo/feedback-loop/production/MinimizationStrategy.h>
 #include <ginkgo/feedback-loop/production/FluentClosureUsage.h>
+#include <ginkgo/feedback-loop/production/SolverBackend.h>
+#include <ginkgo/feedback-loop/production/ExplicitStateChecking.h>
 #include <ginkgo/feedback-loop/production/LogLevel.h>
 #include <ginkgo/utils/Statistics.h>
 
@@ -44,6 +46,30 @@ struct ConfigurationBase
 	typename S<production::MinimizationStrategy>::Set minimizationStrategy;
 	// Selected fluent closure usage
 	typename S<production::FluentClosureUsage>::Set fluentClosureUsage;
+	// Selected backend for grounding and solving proofs
+	typename S<production::SolverBackend>::Set solverBackend;
+	// Whether gringo's output is piped directly into clasp (process backend only)
+	typename S<bool>::Set pipelineProcesses;
+	// Number of hypotheses tested concurrently with the test-all policy
+	typename S<size_t>::Set proofWorkers;
+	// Number of literal windows tested concurrently while minimizing constraints
+	typename S<size_t>::Set speculativeMinimizationCandidates;
+	// Number of hypotheses of equal degree grounded at once in proof sessions
+	typename S<size_t>::Set proofBatchSize;
+	// Whether transition systems are grounded once per proof type and degree and reused by all proofs
+	typename S<bool>::Set pregroundTransitionSystems;
+	// Whether the models of unsuccessful proofs are kept to refute later hypotheses without solving
+	typename S<bool>::Set keepCounterexamples;
+	// Whether the instance is reduced to its reachable actions and fluents before grounding
+	typename S<bool>::Set reduceProgram;
+	// Whether the fluent closure is computed once and passed to the proofs as facts
+	typename S<bool>::Set precomputeFluentClosure;
+	// Number of simulated walks used to refute hypotheses without solving (0 = no simulation)
+	typename S<size_t>::Set simulatedWalks;
+	// Selected usage of the explicit-state checker for state-wise proofs of low degree
+	typename S<production::ExplicitStateChecking>::Set explicitStateChecking;
+	// Maximum number of states and transitions enumerated by the explicit-state checker
+	typename S<size_t>::Set explicitStateBound;
 	// Selected number of constraints to extract
 	typename S<size_t>::Set constraintsToExtract;
 	// Selected number of constraints to prove before termination
@@ -102,6 +128,18 @@ Configuration<Aggregated> Configuration<Aggregated>::aggregate(
 	aggregatedConfiguration.testingPolicy.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).testingPolicy;}, selector);
 	aggregatedConfiguration.minimizationStrategy.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).minimizationStrategy;}, selector);
 	aggregatedConfiguration.fluentClosureUsage.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).fluentClosureUsage;}, selector);
+	aggregatedConfiguration.solverBackend.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).solverBackend;}, selector);
+	aggregatedConfiguration.pipelineProcesses.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).pipelineProcesses;}, selector);
+	aggregatedConfiguration.proofWorkers.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).proofWorkers;}, selector);
+	aggregatedConfiguration.speculativeMinimizationCandidates.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).speculativeMinimizationCandidates;}, selector);
+	aggregatedConfiguration.proofBatchSize.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).proofBatchSize;}, selector);
+	aggregatedConfiguration.pregroundTransitionSystems.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).pregroundTransitionSystems;}, selector);
+	aggregatedConfiguration.keepCounterexamples.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).keepCounterexamples;}, selector);
+	aggregatedConfiguration.reduceProgram.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).reduceProgram;}, selector);
+	aggregatedConfiguration.precomputeFluentClosure.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).precomputeFluentClosure;}, selector);
+	aggregatedConfiguration.simulatedWalks.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).simulatedWalks;}, selector);
+	aggregatedConfiguration.explicitStateChecking.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).explicitStateChecking;}, selector);
+	aggregatedConfiguration.explicitStateBound.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).explicitStateBound;}, selector);
 	aggregatedConfiguration.constraintsToExtract.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).constraintsToExtract;}, selector);
 	aggregatedConfiguration.constraintsToProve.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).constraintsToProve;}, selector);
 	aggregatedConfiguration.maxDegree.aggregate(plainConfigurations, [&](const auto &e) {return accessor(e).maxDegree;}, selector);
@@ -0,0 +1,110 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__COUNTEREXAMPLE_STORE_H
+#define __FEEDBACK_LOOP__PRODUCTION__COUNTEREXAMPLE_STORE_H
+
+#include <deque>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <ginkgo/feedback-loop/production/ProofMethod.h>
+
+#include <ginkgo/solving/GeneralizedConstraint.h>
+#include <ginkgo/solving/SymbolTable.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Counterexample
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// State trace, such as the model of an unsuccessful proof
+struct Counterexample
+{
+	// Only traces starting in the initial state refute induction base proofs
+	bool startsInInitialState;
+	// Last time step of the proof
+	size_t horizon;
+	// Shown atoms of the model
+	std::vector<std::string> atoms;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CounterexampleStore
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Keeps the state traces of unsuccessful proofs to refute further hypotheses without solving
+//
+// A hypothesis is refuted if some stored trace contains a model of its proof encoding. Proofs start
+// in an arbitrary state, so any part of a stored trace qualifies, except for induction base proofs,
+// which must start in the initial state. Generalized constraints never refer to the action leading
+// to their first state, so a part of a trace complies with the learned constraints if the whole
+// trace does. Traces violating a newly learned constraint are dropped.
+class CounterexampleStore
+{
+	public:
+		// Maximum number of stored traces, the oldest of which are dropped first
+		static const size_t Capacity;
+
+	public:
+		CounterexampleStore(SymbolTable &symbolTable);
+
+		void insert(const Counterexample &counterexample);
+		void addLearnedConstraint(const Constraint &learnedConstraint);
+
+		bool refutes(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod) const;
+
+		size_t size() const;
+
+	private:
+		struct PatternLiteral
+		{
+			// Time step relative to the first state of the constraint
+			size_t time;
+			bool sign;
+			std::string atom;
+		};
+
+		struct Pattern
+		{
+			std::vector<PatternLiteral> literals;
+			size_t degree;
+		};
+
+		struct Trace
+		{
+			bool startsInInitialState;
+			// Atoms at each time step, without their time argument
+			std::vector<std::unordered_set<std::string>> timeSteps;
+		};
+
+		// Fails for constraints with literals that are not part of state traces
+		static bool makePattern(const Constraint &constraint, Pattern &pattern);
+		static bool isViolated(const Pattern &pattern, const Trace &trace, size_t time);
+
+		bool refutesStateWiseProof(const Pattern &hypothesis) const;
+		bool refutesInductionProof(const Pattern &hypothesis) const;
+
+		SymbolTable &m_symbolTable;
+
+		std::deque<Trace> m_traces;
+		std::vector<Pattern> m_learnedConstraints;
+		// Traces cannot be checked against learned constraints that have no pattern
+		bool m_isDisabled;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EVENT_EXPLICIT_STATE_CHECKED_H
+#define __FEEDBACK_LOOP__PRODUCTION__EVENT_EXPLICIT_STATE_CHECKED_H
+
+#include <iosfwd>
+#include <json/value.h>
+
+#include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventExplicitStateChecked
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventExplicitStateChecked
+{
+	static EventExplicitStateChecked fromJSON(const Json::Value &json);
+	Json::Value toJSON() const;
+
+	EventHypothesisTested::Purpose purpose;
+	size_t hypothesisDegree;
+	size_t hypothesisLiterals;
+	ProofResult proofResult;
+	double checkTime;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EVENT_FEEDBACK_SIMULATED_H
+#define __FEEDBACK_LOOP__PRODUCTION__EVENT_FEEDBACK_SIMULATED_H
+
+#include <iosfwd>
+#include <json/value.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventFeedbackSimulated
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventFeedbackSimulated
+{
+	static EventFeedbackSimulated fromJSON(const Json::Value &json);
+	Json::Value toJSON() const;
+
+	size_t testedHypotheses;
+	size_t refutedHypotheses;
+	// Number of simulated traces the hypotheses were checked against
+	size_t traces;
+	double simulationTime;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EVENT_FLUENT_CLOSURE_PRECOMPUTED_H
+#define __FEEDBACK_LOOP__PRODUCTION__EVENT_FLUENT_CLOSURE_PRECOMPUTED_H
+
+#include <iosfwd>
+#include <json/value.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventFluentClosurePrecomputed
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventFluentClosurePrecomputed
+{
+	static EventFluentClosurePrecomputed fromJSON(const Json::Value &json);
+	Json::Value toJSON() const;
+
+	// Number of fluents in the closure
+	size_t fluents;
+	double precomputationTime;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EVENT_HYPOTHESIS_REFUTED_H
+#define __FEEDBACK_LOOP__PRODUCTION__EVENT_HYPOTHESIS_REFUTED_H
+
+#include <iosfwd>
+#include <json/value.h>
+
+#include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventHypothesisRefuted
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventHypothesisRefuted
+{
+	static EventHypothesisRefuted fromJSON(const Json::Value &json);
+	Json::Value toJSON() const;
+
+	EventHypothesisTested::Purpose purpose;
+	size_t hypothesisDegree;
+	size_t hypothesisLiterals;
+	// Number of stored counterexamples the hypothesis was checked against
+	size_t counterexamples;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
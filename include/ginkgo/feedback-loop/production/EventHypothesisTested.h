@@ -4,6 +4,7 @@
 #include <iosfwd>
 #include <json/value.h>
 
+#include <ginkgo/feedback-loop/production/ProofMethod.h>
 #include <ginkgo/feedback-loop/production/ProofType.h>
 #include <ginkgo/feedback-loop/production/ProofResult.h>
 
@@ -37,6 +38,10 @@ struct EventHypothesisTested
 	size_t hypothesisDegree;
 	size_t hypothesisLiterals;
 	ProofResult proofResult;
+	// Whether the proof was aborted because another proof already decided the hypothesis
+	bool cancelled;
+	// Proof method that proved the hypothesis first (Unknown if unproven)
+	ProofMethod winningProofMethod;
 	double groundingTime;
 	Json::Value claspJSONOutput;
 };
@@ -26,7 +26,10 @@ struct EventMinimized
 	size_t remainingLiterals;
 	size_t decreasedDegree;
 	size_t finalDegree;
+	// Tests whose results were used for the minimized constraint
 	size_t requiredTests;
+	// Tests run ahead of time whose results had to be discarded
+	size_t speculativeTests;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
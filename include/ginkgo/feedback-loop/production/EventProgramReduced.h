@@ -0,0 +1,41 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EVENT_PROGRAM_REDUCED_H
+#define __FEEDBACK_LOOP__PRODUCTION__EVENT_PROGRAM_REDUCED_H
+
+#include <iosfwd>
+#include <json/value.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventProgramReduced
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventProgramReduced
+{
+	static EventProgramReduced fromJSON(const Json::Value &json);
+	Json::Value toJSON() const;
+
+	size_t facts;
+	size_t reducedFacts;
+	size_t fluents;
+	size_t reachableFluents;
+	size_t staticFluents;
+	size_t actions;
+	size_t reachableActions;
+	double reductionTime;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
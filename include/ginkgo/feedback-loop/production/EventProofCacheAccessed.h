@@ -0,0 +1,42 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EVENT_PROOF_CACHE_ACCESSED_H
+#define __FEEDBACK_LOOP__PRODUCTION__EVENT_PROOF_CACHE_ACCESSED_H
+
+#include <iosfwd>
+#include <json/value.h>
+
+#include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventProofCacheAccessed
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EventProofCacheAccessed
+{
+	static EventProofCacheAccessed fromJSON(const Json::Value &json);
+	Json::Value toJSON() const;
+
+	EventHypothesisTested::Purpose purpose;
+	size_t hypothesisDegree;
+	size_t hypothesisLiterals;
+	bool hit;
+	// Cached proof result (Unknown on cache misses)
+	ProofResult proofResult;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
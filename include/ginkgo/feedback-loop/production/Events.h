@@ -17,6 +17,12 @@
 #include <ginkgo/feedback-loop/production/EventConstraintsRemoved.h>
 #include <ginkgo/feedback-loop/production/EventMinimized.h>
 #include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+#include <ginkgo/feedback-loop/production/EventProofCacheAccessed.h>
+#include <ginkgo/feedback-loop/production/EventHypothesisRefuted.h>
+#include <ginkgo/feedback-loop/production/EventFeedbackSimulated.h>
+#include <ginkgo/feedback-loop/production/EventExplicitStateChecked.h>
+#include <ginkgo/feedback-loop/production/EventProgramReduced.h>
+#include <ginkgo/feedback-loop/production/EventFluentClosurePrecomputed.h>
 #include <ginkgo/feedback-loop/production/EventConstraintLearned.h>
 #include <ginkgo/feedback-loop/production/EventFinished.h>
 
@@ -51,6 +57,12 @@ class Events
 		void notifyConstraintsRemoved(const EventConstraintsRemoved &event);
 		void notifyMinimized(const EventMinimized &event);
 		void notifyHypothesisTested(const EventHypothesisTested &event);
+		void notifyProofCacheAccessed(const EventProofCacheAccessed &event);
+		void notifyHypothesisRefuted(const EventHypothesisRefuted &event);
+		void notifyFeedbackSimulated(const EventFeedbackSimulated &event);
+		void notifyExplicitStateChecked(const EventExplicitStateChecked &event);
+		void notifyProgramReduced(const EventProgramReduced &event);
+		void notifyFluentClosurePrecomputed(const EventFluentClosurePrecomputed &event);
 		void notifyConstraintLearned(const EventConstraintLearned &event);
 		void notifyFinished(const EventFinished &event);
 
@@ -58,6 +70,12 @@ class Events
 		const std::vector<Timed<EventConstraintsRemoved>> &eventsConstraintsRemoved() const;
 		const std::vector<Timed<EventMinimized>> &eventsMinimized() const;
 		const std::vector<Timed<EventHypothesisTested>> &eventsHypothesisTested() const;
+		const std::vector<Timed<EventProofCacheAccessed>> &eventsProofCacheAccessed() const;
+		const std::vector<Timed<EventHypothesisRefuted>> &eventsHypothesisRefuted() const;
+		const std::vector<Timed<EventFeedbackSimulated>> &eventsFeedbackSimulated() const;
+		const std::vector<Timed<EventExplicitStateChecked>> &eventsExplicitStateChecked() const;
+		const std::vector<Timed<EventProgramReduced>> &eventsProgramReduced() const;
+		const std::vector<Timed<EventFluentClosurePrecomputed>> &eventsFluentClosurePrecomputed() const;
 		const std::vector<Timed<EventConstraintLearned>> &eventsConstraintLearned() const;
 		const Timed<EventFinished> &eventFinished() const;
 
@@ -68,6 +86,12 @@ class Events
 		std::vector<Timed<EventConstraintsRemoved>> m_eventsConstraintsRemoved;
 		std::vector<Timed<EventMinimized>> m_eventsMinimized;
 		std::vector<Timed<EventHypothesisTested>> m_eventsHypothesisTested;
+		std::vector<Timed<EventProofCacheAccessed>> m_eventsProofCacheAccessed;
+		std::vector<Timed<EventHypothesisRefuted>> m_eventsHypothesisRefuted;
+		std::vector<Timed<EventFeedbackSimulated>> m_eventsFeedbackSimulated;
+		std::vector<Timed<EventExplicitStateChecked>> m_eventsExplicitStateChecked;
+		std::vector<Timed<EventProgramReduced>> m_eventsProgramReduced;
+		std::vector<Timed<EventFluentClosurePrecomputed>> m_eventsFluentClosurePrecomputed;
 		std::vector<Timed<EventConstraintLearned>> m_eventsConstraintLearned;
 		Timed<EventFinished> m_eventFinished;
 
@@ -0,0 +1,39 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__EXPLICIT_STATE_CHECKING_H
+#define __FEEDBACK_LOOP__PRODUCTION__EXPLICIT_STATE_CHECKING_H
+
+#include <iosfwd>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ExplicitStateChecking
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class ExplicitStateChecking
+{
+	Unknown,
+	NoExplicitStateChecking,
+	UseExplicitStateChecking,
+	// Checks explicitly and proves with the solver, reporting differing results
+	CrossCheckExplicitStateChecking
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::ostream &operator<<(std::ostream &ostream, const ExplicitStateChecking &explicitStateChecking);
+std::istream &operator>>(std::istream &istream, ExplicitStateChecking &explicitStateChecking);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
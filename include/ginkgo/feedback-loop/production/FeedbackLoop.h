@@ -3,12 +3,22 @@
 
 #include <mutex>
 #include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <tuple>
 
 #include <ginkgo/feedback-loop/production/Environment.h>
 #include <ginkgo/feedback-loop/production/ProofResult.h>
 #include <ginkgo/feedback-loop/production/Events.h>
+#include <ginkgo/feedback-loop/production/HypothesisTest.h>
+#include <ginkgo/feedback-loop/production/CounterexampleStore.h>
+#include <ginkgo/feedback-loop/production/ProofCache.h>
+#include <ginkgo/feedback-loop/production/ProofSession.h>
+#include <ginkgo/feedback-loop/production/Simulator.h>
 
 #include <ginkgo/solving/GeneralizedConstraint.h>
+#include <ginkgo/solving/GroundProgram.h>
 
 namespace ginkgo
 {
@@ -32,10 +42,26 @@ class FeedbackLoop
 		static const std::string StateGeneratorEncoding;
 		// Generates initial states with the fluent closure via forward chaining
 		static const std::string FluentClosureEncoding;
-		// Check whether the hypothesis holds
+		// Generates initial states with the precomputed fluent closure facts
+		static const std::string PrecomputedFluentClosureEncoding;
+		// Establishes the initial state of the instance
+		static const std::string InitialStateEncoding;
+		// Transition rules of the proofs, which only depend on the instance and the degree
 		static const std::string StateWiseProofEncoding;
 		static const std::string InductionProofBaseEncoding;
 		static const std::string InductionProofStepEncoding;
+		// Check whether the hypothesis holds
+		static const std::string StateWiseProofCheckEncoding;
+		static const std::string InductionProofBaseCheckEncoding;
+		static const std::string InductionProofStepCheckEncoding;
+		// Restricts the models of proofs to the state traces, which are kept as counterexamples
+		static const std::string CounterexampleEncoding;
+
+	public:
+		// Reports the constraints rejected for their degree or number of literals and returns the number of
+		// the others, which include the empty constraints reported along with the subsumed ones
+		static size_t notifyRejectedFeedback(const std::map<Constraint::FilterResult, size_t> &rejectedFeedback,
+			size_t extractedConstraints, Events &events);
 
 	public:
 		FeedbackLoop(std::unique_ptr<Environment> environment, std::unique_ptr<Configuration<Plain>> configuration);
@@ -45,27 +71,105 @@ class FeedbackLoop
 
 	private:
 		void mergeEncodings();
-		void generateFeedback(size_t constraintsToExtract, bool startOver = true);
+		void startProofSessions();
+		// Returns the number of extracted constraints, including those rejected while parsing
+		size_t generateFeedback(size_t constraintsToExtract, bool startOver = true);
+		bool testFeedbackConcurrently();
+		bool checkProofResult(ProofResult proofResult) const;
+		void learnConstraint(const ConstraintPtr &constraint, GeneralizedConstraint hypothesis);
 		GeneralizedConstraint minimizeConstraint(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement);
-		ProofResult testHypothesisStateWise(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose);
-		ProofResult testHypothesisInduction(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose);
+		GeneralizedConstraint minimizeConstraintSequentially(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement, size_t &requiredTests);
+		GeneralizedConstraint minimizeConstraintSpeculatively(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement, size_t &requiredTests, size_t &speculativeTests);
+		GeneralizedConstraint minimizeConstraintQuickXplain(const GeneralizedConstraint &provenGeneralizedConstraint, size_t &requiredTests);
+		std::vector<size_t> quickXplain(const GeneralizedConstraint &provenGeneralizedConstraint, const std::vector<size_t> &background,
+			bool backgroundChanged, const std::vector<size_t> &candidates, size_t &requiredTests);
+		GeneralizedConstraint minimizeConstraintWithUnsatCores(const GeneralizedConstraint &provenGeneralizedConstraint, size_t &requiredTests);
+		bool findRequiredLiterals(const GeneralizedConstraint &generalizedHypothesis, std::vector<size_t> &requiredLiterals, size_t &requiredTests);
+
+		ProofResult testHypothesis(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose);
+		bool findCachedProofResult(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose, ProofResult &proofResult);
+		void cacheProofResult(const GeneralizedConstraint &generalizedHypothesis, size_t learnedConstraints, ProofResult proofResult);
+		bool refuteWithCounterexamples(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose, ProofResult &proofResult);
+		void storeCounterexamples(const std::vector<Counterexample> &counterexamples);
+		bool checkExplicitStates(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose, ProofResult &proofResult);
+		void reduceProgram();
+		void precomputeFluentClosure();
+		const std::string &stateGeneratorEncoding() const;
+		void readTransitionSystem();
+		void simulateTraces();
+		void filterFeedbackBySimulation();
+		std::unique_ptr<HypothesisTest> makeHypothesisTest(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose);
+		// Guarded literals are only part of the hypothesis if the corresponding atom keep(i) holds
+		void encodeHypothesis(std::ostream &ostream, const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals);
+		// With a ground transition system, only the part of the proof to be appended to it is encoded
+		Encoding encodeStateWiseProof(const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals = false,
+			const GroundProgram *groundTransitionSystem = nullptr);
+		Encoding encodeInductionBaseProof(const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals = false,
+			const GroundProgram *groundTransitionSystem = nullptr);
+		Encoding encodeInductionStepProof(const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals = false,
+			const GroundProgram *groundTransitionSystem = nullptr);
+		// Appends the hypothesis, the check, and the learned constraints to the transition system
+		Encoding encodeProof(ProofType proofType, size_t degree, const GeneralizedConstraint &generalizedHypothesis,
+			bool guardLiterals, const std::string &checkEncoding, const GroundProgram *groundTransitionSystem);
+		// Appends the instance, the domain, and the transition rules, or only the interface of the ground
+		// transition system if given
+		void encodeTransitionSystem(Encoding &encoding, ProofType proofType, size_t degree,
+			const GroundProgram *groundTransitionSystem);
+		// Prints the transition rules without the instance and domain
+		void encodeTransitionRules(std::ostream &ostream, ProofType proofType, size_t degree);
+		// Grounds the instance, the domain, and the transition rules only once per proof type and degree
+		// (null if not enabled or grounding failed)
+		std::shared_ptr<const GroundProgram> pregroundTransitionSystem(ProofType proofType, size_t degree);
+		// Grounds the hypothesis together with the following ones of equal degree in the feedback
+		void groundProofBatch(const GeneralizedConstraint &generalizedHypothesis);
+		ProofResult testHypothesisWithProofSessions(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose);
+
+	private:
+		// Hypothesis test running on a separate thread
+		struct ProofJob
+		{
+			ConstraintPtr constraint;
+			std::unique_ptr<HypothesisTest> hypothesisTest;
+			// Number of learned constraints the proof encodings were built with
+			size_t learnedConstraints;
+			std::future<ProofResult> proofResult;
+		};
 
 		std::unique_ptr<Environment> m_environment;
 		std::unique_ptr<Configuration<Plain>> m_configuration;
 
 		AsyncProcess m_gringo;
-		AsyncProcess m_clasp;
 		AsyncProcess m_xclasp;
 
+		ProofSession m_stateWiseProofSession;
+		ProofSession m_inductionBaseProofSession;
+		ProofSession m_inductionStepProofSession;
+
 		std::condition_variable m_pauseCondition;
 		std::mutex m_pauseConditionMutex;
 
 		Constraints m_feedback;
+		// Numbers of constraints in the last extracted batch rejected while parsing, by filter
+		std::map<Constraint::FilterResult, size_t> m_rejectedFeedback;
+		// Constraints popped from the feedback whose tests are still running
+		std::deque<ProofJob> m_proofJobs;
 
 		Events m_events;
 
-		std::stringstream m_program;
+		// Instance, domain, and learned constraints shared by all proof encodings
+		EncodingBuilder m_encodingBuilder;
+		// Ground transition systems by proof type and degree (null if grounding failed)
+		std::map<std::tuple<ProofType, size_t>, std::shared_ptr<const GroundProgram>> m_groundTransitionSystems;
+		// Fluent closure facts and their state generator (empty if not precomputed)
+		std::string m_precomputedFluentClosure;
 		Constraints m_learnedConstraints;
+
+		ProofCache m_proofCache;
+		CounterexampleStore m_counterexampleStore;
+		// Transition system given by the instance and domain facts (if read)
+		std::unique_ptr<Simulator> m_simulator;
+		// Traces of the forward simulation, which are kept separately to measure their effect
+		CounterexampleStore m_simulatedTraces;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,97 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__HYPOTHESIS_TEST_H
+#define __FEEDBACK_LOOP__PRODUCTION__HYPOTHESIS_TEST_H
+
+#include <sstream>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+#include <ginkgo/feedback-loop/production/CounterexampleStore.h>
+#include <ginkgo/feedback-loop/production/Environment.h>
+#include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+#include <ginkgo/feedback-loop/production/ProofMethod.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+#include <ginkgo/feedback-loop/production/ProofType.h>
+#include <ginkgo/feedback-loop/production/Prover.h>
+#include <ginkgo/feedback-loop/production/SolverBackend.h>
+
+#include <ginkgo/solving/GeneralizedConstraint.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// HypothesisTest
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Runs all proofs required for a hypothesis concurrently, each with its own prover
+//
+// The hypothesis is proven as soon as all proofs of one proof method succeed. The proof encodings
+// are prepared in advance, so that the test can run on a separate thread. The events are only
+// collected and have to be recorded by the owner of the test.
+class HypothesisTest
+{
+	public:
+		HypothesisTest(const Environment &environment, SolverBackend solverBackend, bool pipelineProcesses,
+			bool keepCounterexamples, const std::chrono::milliseconds &timeout, const GeneralizedConstraint &hypothesis,
+			EventHypothesisTested::Purpose purpose);
+
+		// Proofs of a method are cancelled as soon as one of them fails, and all other proofs are
+		// cancelled once a method succeeds
+		// With a ground program, the proof encoding is grounded on its own and appended to it
+		void addProof(ProofMethod proofMethod, ProofType proofType, Encoding &&proofEncoding,
+			std::shared_ptr<const GroundProgram> groundProgram = nullptr);
+
+		ProofResult run();
+
+		// Aborts the test, whose events are then discarded (thread-safe)
+		void cancel();
+		bool isCancelled();
+
+		const GeneralizedConstraint &hypothesis() const;
+		const std::vector<EventHypothesisTested> &events() const;
+		// Models of the unsuccessful proofs
+		const std::vector<Counterexample> &counterexamples() const;
+
+	private:
+		struct Proof
+		{
+			ProofMethod proofMethod;
+			ProofType proofType;
+			Encoding encoding;
+			std::shared_ptr<const GroundProgram> groundProgram;
+			std::unique_ptr<Prover> prover;
+			ProofResult proofResult;
+		};
+
+	private:
+		const Environment &m_environment;
+		SolverBackend m_solverBackend;
+		bool m_pipelineProcesses;
+		bool m_keepCounterexamples;
+		std::chrono::milliseconds m_timeout;
+
+		GeneralizedConstraint m_hypothesis;
+		EventHypothesisTested::Purpose m_purpose;
+
+		std::vector<Proof> m_proofs;
+		std::vector<EventHypothesisTested> m_events;
+		std::vector<Counterexample> m_counterexamples;
+
+		std::atomic<bool> m_cancelled;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -21,7 +21,11 @@ enum class MinimizationStrategy
 	Unknown,
 	NoMinimization,
 	SimpleMinimization,
-	LinearMinimization
+	LinearMinimization,
+	// Recursively halves the literals, which needs few proofs if most literals can be removed
+	QuickXplainMinimization,
+	// Drops all literals outside of the unsatisfiable cores of the proofs (clingo backends only)
+	UnsatCoreMinimization
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
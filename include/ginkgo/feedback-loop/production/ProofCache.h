@@ -0,0 +1,59 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__PROOF_CACHE_H
+#define __FEEDBACK_LOOP__PRODUCTION__PROOF_CACHE_H
+
+#include <string>
+#include <unordered_map>
+
+#include <ginkgo/feedback-loop/production/ProofMethod.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+
+#include <ginkgo/solving/GeneralizedConstraint.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ProofCache
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Remembers proof results of hypotheses, regardless of their position in time and literal order
+//
+// Results are stamped with the number of learned constraints they were obtained with. Learned
+// constraints only make proofs easier, so proven results stay valid, while all other results are
+// only reused as long as no further constraints have been learned.
+class ProofCache
+{
+	public:
+		bool find(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod, size_t learnedConstraints,
+			ProofResult &proofResult) const;
+		void insert(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod, size_t learnedConstraints,
+			ProofResult proofResult);
+
+		size_t size() const;
+
+		// Normalized literals in lexicographical order, followed by the proof method
+		static std::string key(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod);
+
+	private:
+		struct Entry
+		{
+			ProofResult proofResult;
+			size_t learnedConstraints;
+		};
+
+		std::unordered_map<std::string, Entry> m_entries;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -20,7 +20,9 @@ enum class ProofMethod
 {
 	Unknown,
 	StateWiseProof,
-	InductionProof
+	InductionProof,
+	// Races state-wise and induction proofs
+	Portfolio
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
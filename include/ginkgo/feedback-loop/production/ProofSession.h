@@ -0,0 +1,88 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__PROOF_SESSION_H
+#define __FEEDBACK_LOOP__PRODUCTION__PROOF_SESSION_H
+
+#include <string>
+#include <chrono>
+#include <unordered_map>
+
+#include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+#include <ginkgo/feedback-loop/production/ProofType.h>
+
+#include <ginkgo/solving/ClingoSolver.h>
+#include <ginkgo/solving/Constraints.h>
+#include <ginkgo/solving/GeneralizedConstraint.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ProofSession
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Proves hypotheses of one proof type with a persistent multi-shot clingo session
+//
+// The instance, the domain, and the initial states are grounded only once. Time steps are grounded
+// on demand and enabled with externals, while each hypothesis is added as a separate program part
+// and released after it has been tested. The solver keeps its learned nogoods between proofs.
+//
+// Batches of hypotheses can be grounded ahead of their proofs in a single program part, in which
+// case each hypothesis is selected by assuming its external atom.
+class ProofSession
+{
+	public:
+		// Transition rules of one time step, which is only active if the external active(t) is set
+		static const std::string StepEncoding;
+
+	public:
+		ProofSession(ProofType proofType);
+
+		// Grounds the instance, the domain, and the initial states, which starts a new session
+		void groundProgram(const std::string &program);
+
+		// Grounds hypotheses to be proven next, unless the first one has already been grounded
+		void groundHypotheses(const std::vector<GeneralizedConstraint> &hypotheses);
+
+		// Fills in the proof result, grounding time, and solver statistics of the event
+		ProofResult prove(const GeneralizedConstraint &hypothesis, const Constraints &learnedConstraints,
+			const std::chrono::milliseconds &timeout, EventHypothesisTested &event);
+		// Shown atoms of the model found by the last unsuccessful proof
+		const std::vector<std::string> &model() const;
+
+	private:
+		void extendHorizon(size_t horizon);
+		void groundLearnedConstraints(const Constraints &learnedConstraints);
+		void groundHypothesis(const GeneralizedConstraint &hypothesis);
+		void encodeHypothesis(std::ostream &encoding, const GeneralizedConstraint &hypothesis, size_t hypothesisID) const;
+		void releaseGroundedHypotheses();
+
+		ProofType m_proofType;
+
+		ClingoSolver m_clingo;
+
+		// Number of grounded time steps
+		size_t m_horizon;
+		// Number of learned constraints grounded for all time steps up to the horizon
+		size_t m_groundedLearnedConstraints;
+		size_t m_numberOfParts;
+		size_t m_numberOfHypotheses;
+
+		// IDs of hypotheses grounded ahead of their proofs, indexed by their generalized form
+		std::unordered_map<std::string, size_t> m_groundedHypotheses;
+		// Time spent grounding the current batch, which is accounted to its first proof
+		double m_batchGroundingTime;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__PROVER_H
+#define __FEEDBACK_LOOP__PRODUCTION__PROVER_H
+
+#include <sstream>
+#include <chrono>
+#include <mutex>
+
+#include <ginkgo/feedback-loop/production/Environment.h>
+#include <ginkgo/feedback-loop/production/EventHypothesisTested.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+#include <ginkgo/feedback-loop/production/SolverBackend.h>
+
+#include <ginkgo/solving/AsyncProcess.h>
+#include <ginkgo/solving/ClingoSolver.h>
+#include <ginkgo/solving/GroundProgram.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Prover
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Grounds and solves proof encodings with the selected solver backend
+class Prover
+{
+	public:
+		// With pipelined processes, gringo's output is passed to clasp without being buffered. clasp only
+		// prints the models of unsuccessful proofs if they are kept
+		Prover(const Environment &environment, SolverBackend solverBackend, bool pipelineProcesses, bool keepModels);
+
+		// Fills in the proof result, grounding time, and solver statistics of the event
+		ProofResult prove(const Encoding &proofEncoding, const std::chrono::milliseconds &timeout,
+			EventHypothesisTested &event);
+		// Assumptions and unsatisfiable cores are only supported by the clingo backends
+		ProofResult prove(const Encoding &proofEncoding, const std::vector<ClingoSolver::Assumption> &assumptions,
+			const std::chrono::milliseconds &timeout, EventHypothesisTested &event);
+		// Grounds the encoding on its own and appends it to the ground program (process backend only)
+		ProofResult prove(const GroundProgram &groundProgram, const Encoding &proofEncoding,
+			const std::chrono::milliseconds &timeout, EventHypothesisTested &event);
+		const std::vector<std::string> &core() const;
+		// Shown atoms of the model found by the last unsuccessful proof
+		const std::vector<std::string> &model() const;
+
+		// Aborts the running and all future proofs, which then have an unknown result (thread-safe)
+		void cancel();
+		bool isCancelled();
+
+	private:
+		// Pipelines are not used with a ground program, which the grounder's output has to be linked to first
+		ProofResult proveWithProcesses(const Encoding &proofEncoding, const GroundProgram *groundProgram,
+			const std::chrono::milliseconds &timeout, EventHypothesisTested &event);
+		ProofResult proveWithClingo(const Encoding &proofEncoding, const std::vector<ClingoSolver::Assumption> &assumptions,
+			const std::chrono::milliseconds &timeout, EventHypothesisTested &event);
+
+		SolverBackend m_solverBackend;
+		bool m_pipelineProcesses;
+
+		std::mutex m_cancelMutex;
+		bool m_cancelled;
+
+		AsyncProcess m_gringo;
+		AsyncProcess m_clasp;
+		ClingoSolver m_clingo;
+
+		std::vector<std::string> m_model;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
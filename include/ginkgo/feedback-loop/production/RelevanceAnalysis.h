@@ -0,0 +1,67 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__RELEVANCE_ANALYSIS_H
+#define __FEEDBACK_LOOP__PRODUCTION__RELEVANCE_ANALYSIS_H
+
+#include <string>
+#include <vector>
+
+#include <ginkgo/solving/SymbolTable.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// RelevanceAnalysis
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reduces planning instances to the fluents and actions that matter for reachable states
+//
+// Actions are reachable if their positive demands are met in the relaxed fluent closure of the
+// initial state. Static fluents are neither added nor deleted by reachable actions and keep their
+// initial value, so reachable actions that demand otherwise are removed, and demands that are always
+// met are dropped. Fluents outside of the closure never hold and are removed as well. The reachable
+// states are unaffected, so constraints proven for the reduced instance remain valid.
+class RelevanceAnalysis
+{
+	public:
+		// Computes all atoms of the instance and domain, which fails if they do not have a unique model
+		// or refer to states directly
+		static bool computeFacts(const std::string &program, std::vector<std::string> &atoms);
+
+	public:
+		RelevanceAnalysis(const std::vector<std::string> &atoms, SymbolTable &symbolTable);
+
+		// Facts of all atoms that were not removed
+		std::string reducedProgram() const;
+
+		size_t numberOfFacts() const;
+		size_t numberOfReducedFacts() const;
+		size_t numberOfFluents() const;
+		size_t numberOfReachableFluents() const;
+		size_t numberOfStaticFluents() const;
+		size_t numberOfActions() const;
+		size_t numberOfReachableActions() const;
+
+	private:
+		std::vector<std::string> m_facts;
+		std::vector<bool> m_isRemoved;
+
+		size_t m_numberOfFluents;
+		size_t m_numberOfReachableFluents;
+		size_t m_numberOfStaticFluents;
+		size_t m_numberOfActions;
+		size_t m_numberOfReachableActions;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
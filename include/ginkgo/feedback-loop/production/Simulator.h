@@ -0,0 +1,133 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__SIMULATOR_H
+#define __FEEDBACK_LOOP__PRODUCTION__SIMULATOR_H
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ginkgo/feedback-loop/production/CounterexampleStore.h>
+#include <ginkgo/feedback-loop/production/FluentClosureUsage.h>
+#include <ginkgo/feedback-loop/production/ProofResult.h>
+
+#include <ginkgo/solving/Constraints.h>
+#include <ginkgo/solving/SymbolTable.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simulator
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Explores the transition system described by the instance and domain facts without solving
+//
+// Actions are applicable if all their demands are met in the current state. Just like in the proof
+// encodings, deleted fluents are removed and added fluents are set afterward.
+class Simulator
+{
+	public:
+		// Shows the facts the simulator is built from
+		static const std::string FactsEncoding;
+
+	public:
+		// Reads the facts from the model of the instance and domain
+		Simulator(const std::vector<std::string> &atoms, SymbolTable &symbolTable);
+
+		size_t numberOfFluents() const;
+		size_t numberOfActions() const;
+
+		// Follows all action sequences from the initial state, keeping at most maxTraces per time step
+		std::vector<Counterexample> exploreBreadthFirst(size_t horizon, size_t maxTraces) const;
+		// Applies random actions, starting in the initial state
+		std::vector<Counterexample> walkFromInitialState(size_t horizon, size_t walks, std::mt19937 &generator) const;
+		// Applies random actions, starting in random states over the fluent closure
+		std::vector<Counterexample> walkFromFluentClosure(size_t horizon, size_t walks, std::mt19937 &generator) const;
+
+		// Decides the state-wise proof of a hypothesis of degree 0 or 1 by enumerating the start states
+		// over the fluents referred to by the hypothesis and the learned constraints. Fails for other
+		// degrees, for literals other than holds, apply, and del, and if more than maxStates states and
+		// transitions would have to be enumerated
+		bool checkStateWiseProof(const Constraint &hypothesis, const Constraints &learnedConstraints,
+			FluentClosureUsage fluentClosureUsage, size_t maxStates, ProofResult &proofResult) const;
+
+	private:
+		using State = std::vector<bool>;
+
+		struct Action
+		{
+			std::string name;
+			std::vector<size_t> positiveDemands;
+			std::vector<size_t> negativeDemands;
+			std::vector<size_t> adds;
+			std::vector<size_t> deletes;
+		};
+
+		struct Trace
+		{
+			std::vector<State> states;
+			// Actions leading to each state after the first one
+			std::vector<size_t> actions;
+		};
+
+		struct Condition
+		{
+			enum class Type
+			{
+				Holds,
+				Apply,
+				Deleted
+			};
+
+			Type type;
+			// Time step relative to the first state of the constraint
+			size_t time;
+			bool sign;
+			size_t index;
+		};
+
+		struct Conditions
+		{
+			std::vector<Condition> conditions;
+			size_t degree;
+		};
+
+		size_t fluent(const std::string &name);
+		size_t action(const std::string &name);
+
+		bool isApplicable(const Action &action, const State &state) const;
+		State apply(const Action &action, const State &state) const;
+		std::vector<size_t> applicableActions(const State &state) const;
+
+		void walk(Trace &trace, size_t horizon, std::mt19937 &generator) const;
+		Counterexample counterexample(const Trace &trace, bool startsInInitialState) const;
+
+		// Fails for literals other than holds, apply, and del. Constraints with positive literals over
+		// unknown fluents or actions can never be violated
+		bool makeConditions(const Constraint &constraint, Conditions &conditions, bool &canBeViolated) const;
+		bool isViolated(const Conditions &conditions, const Trace &trace, size_t time) const;
+
+		std::vector<std::string> m_fluents;
+		std::unordered_map<std::string, size_t> m_fluentIndices;
+		std::vector<Action> m_actions;
+		std::unordered_map<std::string, size_t> m_actionIndices;
+
+		State m_initialState;
+		// Fluents declared by fluent/1, which are generated in arbitrary start states
+		State m_declaredFluents;
+		State m_fluentClosure;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
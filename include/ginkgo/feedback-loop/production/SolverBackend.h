@@ -0,0 +1,38 @@
+#ifndef __FEEDBACK_LOOP__PRODUCTION__SOLVER_BACKEND_H
+#define __FEEDBACK_LOOP__PRODUCTION__SOLVER_BACKEND_H
+
+#include <iosfwd>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// SolverBackend
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class SolverBackend
+{
+	Unknown,
+	Process,
+	Clingo,
+	ClingoIncremental
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::ostream &operator<<(std::ostream &ostream, const SolverBackend &solverBackend);
+std::istream &operator>>(std::istream &istream, SolverBackend &solverBackend);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+#endif
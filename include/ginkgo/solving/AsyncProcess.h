@@ -4,11 +4,18 @@
 #include <sstream>
 #include <thread>
 #include <array>
+#include <atomic>
 #include <mutex>
 #include <deque>
 #include <chrono>
 #include <iostream>
+#include <functional>
+#include <condition_variable>
+#include <vector>
 
+#include <ginkgo/solving/EncodingBuilder.h>
+#include <ginkgo/solving/ProcessReactor.h>
+#include <ginkgo/utils/LineQueue.h>
 #include <ginkgo/utils/Semaphore.h>
 
 namespace ginkgo
@@ -20,13 +27,16 @@ namespace ginkgo
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Runs a binary as a child process, whose pipes are handled by the shared process reactor
 class AsyncProcess
 {
 	public:
 		struct Configuration
 		{
 			std::string binary;
-			std::initializer_list<std::string> arguments;
+			std::vector<std::string> arguments;
+			// Size of the buffers for reading the output and writing the input, allocated once per process
+			size_t bufferSize = 64 * 1024;
 		};
 
 	public:
@@ -40,11 +50,24 @@ class AsyncProcess
 		std::stringstream *stderr();
 		void clearStderr();
 
+		// Lines of output when splitting lines, each batch of which is signaled by one event
+		LineQueue &stdoutLines();
+		LineQueue &stderrLines();
+
 		bool waitForEvent();
 		bool waitForEvent(const std::chrono::milliseconds &relativeTime, std::cv_status &cvStatus);
 
 		void run(std::stringstream &stdin, bool splitStdoutLines = false, bool splitStderrLines = false);
 		void run(std::stringstream &stdin, const std::chrono::milliseconds &relativeTime, bool &timeout, bool splitStdoutLines = false, bool splitStderrLines = false);
+		// Writes the segments of the encoding without copying them (the encoding must outlive the process)
+		void run(const Encoding &stdin, bool splitStdoutLines = false, bool splitStderrLines = false);
+		void run(const Encoding &stdin, const std::chrono::milliseconds &relativeTime, bool &timeout, bool splitStdoutLines = false, bool splitStderrLines = false);
+		// Connects the stdout of the producer directly to the stdin of the consumer, so that the output is
+		// consumed while it is produced without passing through this process. The consumer's timeout
+		// starts once the producer has finished, and the consumer is killed if the producer times out
+		static void runPipeline(AsyncProcess &producer, AsyncProcess &consumer, const Encoding &stdin,
+			const std::chrono::milliseconds &producerTimeout, bool &producerTimedOut,
+			const std::chrono::milliseconds &consumerTimeout, bool &consumerTimedOut, double &producerTime);
 		bool isRunning() const;
 
 		int exitCode() const;
@@ -54,38 +77,83 @@ class AsyncProcess
 		void terminate() const;
 		void kill() const;
 		bool exists() const;
+		// Kills the running process and keeps all future ones from starting (thread-safe)
+		void cancel();
 
-		void join() const;
+		// Waits until the process has finished and all its output is read
+		void join();
 
 	private:
 		struct Pipe
 		{
 			std::deque<std::stringstream> streams;
+			LineQueue lines;
 			bool splitLines;
 			std::mutex accessMutex;
 		};
 
+		// Writes the next chunk of input to the file descriptor and returns false once all is written
+		using StdinWriter = std::function<bool(int fileDescriptor)>;
+
+		struct Registration
+		{
+			int fileDescriptor;
+			ProcessReactor::Handle handle;
+		};
+
 	private:
-		void runThread(std::stringstream &stdin);
+		void start(StdinWriter writeStdin, bool splitStdoutLines, bool splitStderrLines);
+		void waitFor(const std::chrono::milliseconds &relativeTime, bool &timeout);
+
 		void runChildProcess();
-		void runParentProcess(std::stringstream &stdin);
+		void registerParentFileDescriptors();
+		void closeConnections();
+
+		// Called by the process reactor
+		void handleWrite(uint32_t events);
+		void handleRead(Registration &registration, Pipe &outputPipe, uint32_t events);
+		// Returns false once the pipe is closed
+		bool read(int fileDescriptor, Pipe &outputPipe);
+		void unregister(Registration &registration);
+		void reap();
+		void finish(int status);
 
 		Configuration m_configuration;
 
 		std::array<int, 2> m_inPipe;
 		std::array<int, 2> m_outPipe;
 		std::array<int, 2> m_errPipe;
+		// File descriptors connected to other processes instead of pipes (-1 if unused)
+		int m_stdinFileDescriptor;
+		int m_stdoutFileDescriptor;
 
 		Pipe m_stdout;
 		Pipe m_stderr;
 
 		Semaphore m_eventSemaphore;
 
-		pid_t m_childPID;
+		// Accessed by other threads for sending signals
+		std::atomic<pid_t> m_childPID;
 
 		int m_exitCode;
 
-		mutable std::unique_ptr<std::thread> m_thread;
+		StdinWriter m_writeStdin;
+		std::vector<char> m_buffer;
+
+		Registration m_stdinRegistration;
+		Registration m_stdoutRegistration;
+		Registration m_stderrRegistration;
+		// Only accessed by the reactor thread once the process is started
+		size_t m_openFileDescriptors;
+
+		// Held while starting the process, so that it cannot escape cancellation
+		std::mutex m_cancelMutex;
+		bool m_cancelled;
+
+		std::mutex m_finishedMutex;
+		std::condition_variable m_finishedCondition;
+		bool m_isStarted;
+		bool m_isFinished;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,11 @@
 #ifndef __SOLVING__CLASP_OUTPUT_PARSING_H
 #define __SOLVING__CLASP_OUTPUT_PARSING_H
 
+#include <string>
+#include <vector>
+
+#include <json/value.h>
+
 #include <ginkgo/solving/Process.h>
 #include <ginkgo/solving/Satisfiability.h>
 
@@ -15,6 +20,8 @@ namespace ginkgo
 
 float parseForSolvingTime(std::stringstream &claspOutput);
 Satisfiability parseForSatisfiability(std::stringstream &claspOutputJson);
+// Extracts the atoms of the first model, which are only printed if clasp is not fully quiet
+bool parseForModel(const Json::Value &claspOutput, std::vector<std::string> &atoms);
 bool parseForErrors(std::stringstream &claspOutput);
 bool parseForWarnings(std::stringstream &claspOutput);
 
@@ -0,0 +1,105 @@
+#ifndef __SOLVING__CLINGO_SOLVER_H
+#define __SOLVING__CLINGO_SOLVER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <mutex>
+
+#include <json/value.h>
+
+#include <ginkgo/solving/EncodingBuilder.h>
+#include <ginkgo/solving/Satisfiability.h>
+
+// Forward declarations
+namespace Clingo
+{
+class Control;
+}
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ClingoSolver
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Grounds and solves programs in-process using the clingo library
+class ClingoSolver
+{
+	public:
+		// Atom (such as "active(3)") and the truth value it is assumed to have
+		using Assumption = std::pair<std::string, bool>;
+
+	public:
+		// Computes the shown atoms of the unique model of a program, which fails if the program is
+		// unsatisfiable or its models differ in shown atoms
+		static bool computeUniqueModel(const std::string &program, const std::chrono::milliseconds &timeout,
+			std::vector<std::string> &atoms);
+
+	public:
+		ClingoSolver(std::vector<std::string> arguments = {"--stats"});
+		~ClingoSolver();
+
+		// Grounds and solves a program from scratch
+		Satisfiability solve(const std::string &program, const std::chrono::milliseconds &timeout,
+			bool &groundingTimeout, bool &solvingTimeout);
+		Satisfiability solve(const std::string &program, const std::vector<Assumption> &assumptions,
+			const std::chrono::milliseconds &timeout, bool &groundingTimeout, bool &solvingTimeout);
+		// Adds the segments of the encoding one by one instead of concatenating them
+		Satisfiability solve(const Encoding &program, const std::vector<Assumption> &assumptions,
+			const std::chrono::milliseconds &timeout, bool &groundingTimeout, bool &solvingTimeout);
+
+		// Multi-shot solving: parts are grounded into a persistent session, which keeps learned
+		// nogoods between solve calls until reset
+		void add(const std::string &partName, const std::vector<std::string> &parameters, const std::string &program);
+		void ground(const std::string &partName, const std::vector<int> &arguments = {});
+		Satisfiability solve(const std::vector<Assumption> &assumptions, const std::chrono::milliseconds &timeout,
+			bool &solvingTimeout);
+		void releaseExternal(const std::string &atom);
+		bool hasSession() const;
+		void reset();
+
+		// Interrupts the running and all future solve calls (thread-safe)
+		void interrupt();
+
+		void resetStatistics();
+		double groundingTime() const;
+		// Statistics in the format of clasp's JSON output (--outf=2)
+		const Json::Value &statistics() const;
+		const std::string &warnings() const;
+		// Atoms of the positive assumptions in the unsatisfiable core of the last solve call
+		const std::vector<std::string> &core() const;
+		// Shown atoms of the model found by the last solve call
+		const std::vector<std::string> &model() const;
+
+	private:
+		std::unique_ptr<Clingo::Control> createControl();
+		Satisfiability solve(const std::vector<const char *> &programParts, const std::vector<Assumption> &assumptions,
+			const std::chrono::milliseconds &timeout, bool &groundingTimeout, bool &solvingTimeout);
+		Satisfiability solve(Clingo::Control &control, const std::vector<Assumption> &assumptions,
+			const std::chrono::milliseconds &timeout, bool &solvingTimeout);
+
+		std::vector<std::string> m_arguments;
+
+		std::unique_ptr<Clingo::Control> m_session;
+
+		std::mutex m_interruptMutex;
+		Clingo::Control *m_solvingControl;
+		bool m_interrupted;
+
+		double m_groundingTime;
+		Json::Value m_statistics;
+		std::string m_warnings;
+		std::vector<std::string> m_core;
+		std::vector<std::string> m_model;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
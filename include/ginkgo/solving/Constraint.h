@@ -3,6 +3,7 @@
 
 #include <iosfwd>
 #include <memory>
+#include <string>
 #include <vector>
 #include <tuple>
 
@@ -20,10 +21,35 @@ namespace ginkgo
 class Constraint;
 using ConstraintPtr = std::shared_ptr<Constraint>;
 
+// Limits checked while parsing, so that rejected constraints are not read completely
+struct ConstraintFilter
+{
+	size_t maxDegree;
+	size_t maxNumberOfLiterals;
+	// Literals with this name are dropped (still counting towards the number of literals)
+	std::string removedLiteralName;
+};
+
 class Constraint
 {
 	public:
-		Constraint(size_t id, const std::string &string, SymbolTable &symbolTable);
+		enum class FilterResult
+		{
+			Accepted,
+			DegreeTooHigh,
+			ContainsTooManyLiterals,
+			// All literals were dropped
+			Empty
+		};
+
+		// Applies the filters in the order of degree, number of literals, and dropped literals,
+		// returning null if the constraint is rejected
+		static ConstraintPtr parse(size_t id, boost::string_ref string, SymbolTable &symbolTable,
+			const ConstraintFilter &filter, FilterResult &filterResult);
+
+	public:
+		// Parses constraints as logged by xclasp without copying the text
+		Constraint(size_t id, boost::string_ref string, SymbolTable &symbolTable);
 		Constraint(size_t id, Literals literals, size_t lbd);
 
 		size_t id() const;
@@ -31,6 +57,9 @@ class Constraint
 		size_t numberOfLiterals() const;
 		size_t lbd() const;
 
+		// Independent of the order of the literals, like equality
+		size_t hash() const;
+
 		bool subsumes(const Constraint &rhs) const;
 		bool subsumes(const Constraint &rhs, int offset) const;
 
@@ -39,6 +68,8 @@ class Constraint
 		std::tuple<size_t, size_t> timeRange() const;
 
 		ConstraintPtr withoutLiterals(size_t index, size_t length = 1) const;
+		// Keeps only the literals at the given (ascending) indices
+		ConstraintPtr withLiterals(const std::vector<size_t> &indices) const;
 
 		void removeLiterals(const std::string &literalName);
 
@@ -49,6 +80,8 @@ class Constraint
 		Constraint() = default;
 		Constraint(const Constraint &copy) = delete;
 
+		void parseLBD(boost::string_ref string, size_t position);
+
 		size_t m_id;
 		Literals m_literals;
 		size_t m_lbd;
@@ -57,6 +90,9 @@ class Constraint
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 std::ostream &operator<<(std::ostream &ostream, const Constraint &constraint);
+// Compares the sets of literals
+bool operator==(const Constraint &a, const Constraint &b);
+bool operator!=(const Constraint &a, const Constraint &b);
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
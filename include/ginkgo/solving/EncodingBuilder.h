@@ -0,0 +1,73 @@
+#ifndef __SOLVING__ENCODING_BUILDER_H
+#define __SOLVING__ENCODING_BUILDER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ginkgo/solving/Constraint.h>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Encoding
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Program made of immutable text segments, which are shared between encodings instead of copied
+//
+// Each segment consists of complete statements, so that segments can be passed to the grounder one
+// by one, either with scatter-gather writes or as separate program parts.
+class Encoding
+{
+	public:
+		using Segment = std::shared_ptr<const std::string>;
+
+	public:
+		void append(Segment segment);
+		void append(const std::vector<Segment> &segments);
+		void append(std::string text);
+
+		const std::vector<Segment> &segments() const;
+		size_t size() const;
+		// Concatenates all segments
+		std::string str() const;
+
+	private:
+		std::vector<Segment> m_segments;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EncodingBuilder
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Keeps the instance and the learned constraints as prebuilt segments for all proof encodings
+//
+// Each learned constraint is rendered once into a segment of its own when it is added. Encodings
+// built earlier only refer to the segments that existed back then, so they are not affected by
+// constraints learned in the meantime.
+class EncodingBuilder
+{
+	public:
+		EncodingBuilder();
+
+		void setProgram(std::string program);
+		const Encoding::Segment &program() const;
+
+		void addLearnedConstraint(const ConstraintPtr &learnedConstraint);
+		const std::vector<Encoding::Segment> &learnedConstraints() const;
+
+	private:
+		Encoding::Segment m_program;
+		std::vector<Encoding::Segment> m_learnedConstraints;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef __SOLVING__GROUND_PROGRAM_H
+#define __SOLVING__GROUND_PROGRAM_H
+
+#include <string>
+#include <unordered_map>
+
+#include <ginkgo/solving/EncodingBuilder.h>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// GroundProgram
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Ground program in the aspif format, to which separately grounded programs can be appended
+//
+// Each grounder run numbers its atoms from scratch, so ground programs cannot simply be concatenated.
+// Programs to be appended are therefore grounded along with the interface of this program, which
+// declares its shown atoms as externals (or facts). When appending such a program, its externals are
+// identified with the atoms of this program by their names, and all its other atoms are numbered
+// after the ones of this program.
+class GroundProgram
+{
+	public:
+		GroundProgram();
+
+		// Fails if the program is not a single aspif step or contains theory statements
+		bool read(const std::string &aspif);
+
+		// Shown atoms of this program as externals and facts, to be grounded along with appended programs
+		const Encoding::Segment &interfaceEncoding() const;
+
+		// Appends a program grounded along with the interface, which fails if it cannot be linked
+		bool append(const std::string &aspif, Encoding &linkedProgram) const;
+
+	private:
+		// Statements of this program without the end of the step
+		Encoding::Segment m_program;
+		Encoding::Segment m_interfaceEncoding;
+		// Literals of the shown atoms by name (0 for facts)
+		std::unordered_map<std::string, int> m_shownAtoms;
+		int m_numberOfAtoms;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
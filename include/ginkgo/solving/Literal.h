@@ -7,6 +7,8 @@
 #include <vector>
 #include <set>
 
+#include <boost/utility/string_ref.hpp>
+
 #include <ginkgo/solving/SymbolTable.h>
 
 namespace ginkgo
@@ -34,31 +36,43 @@ class Literal
 		};
 
 	public:
-		Literal(const std::string &string, size_t &startPosition, SymbolTable &symbolTable);
-		Literal(const Literal &copy);
+		// Parses the literal starting at the given position and advances the position past it
+		Literal(boost::string_ref string, size_t &startPosition, SymbolTable &symbolTable);
+		// Advances the position past the literal without constructing it and returns its name
+		static boost::string_ref skip(boost::string_ref string, size_t &startPosition, bool &hasTimeArgument,
+			size_t &timeArgument);
 
 		bool sign() const;
+		// Interned term without the time argument, which literals of either sign and any time step share
+		const SymbolTable::Term *term() const;
+		SymbolTable::Symbol symbol() const;
 		const std::string *name() const;
-		const Literals &arguments() const;
+		// Positive literals of the argument terms, excluding the time argument
+		Literals arguments() const;
 		bool hasTimeArgument() const;
 		size_t timeArgument() const;
 
 		bool equalsShifted(const Literal &rhs, int offset) const;
 
-		Literal normalized(int offset, SymbolTable &symbolTable) const;
+		// Consistent with equality, which compares the interned terms and the time arguments
+		size_t hash() const;
+		// Equal for literals that only differ in their time arguments
+		size_t hashWithoutTime() const;
+
+		Literal normalized(int offset) const;
 
 		void print(std::ostream &ostream) const;
 		void print(std::ostream &ostream, OutputFormat outputFormat, int offset = 0) const;
 
 	private:
-		Literal() = default;
+		Literal(const SymbolTable::Term *term, bool sign);
 
+		// Literals only refer to their terms, so that they are copied trivially
+		const SymbolTable::Term *m_term;
+		// Only valid if the literal has a time argument (zero otherwise)
+		size_t m_timeArgument;
 		bool m_sign;
-		const std::string *m_name;
-		Literals m_arguments;
-
 		bool m_hasTimeArgument;
-		size_t m_timeArgument;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
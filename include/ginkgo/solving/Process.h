@@ -18,6 +18,10 @@ namespace ginkgo
 
 class Process
 {
+	public:
+		// Size of the buffers for writing the input and reading the output
+		static const size_t BufferSize;
+
 	public:
 		Process(std::string binary, const std::vector<std::string> &arguments);
 		virtual ~Process();
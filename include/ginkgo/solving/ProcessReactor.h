@@ -0,0 +1,63 @@
+#ifndef __SOLVING__PROCESS_REACTOR_H
+#define __SOLVING__PROCESS_REACTOR_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ProcessReactor
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Waits for the pipes of all child processes with epoll and runs their handlers on a single thread
+//
+// Registrations are identified by their own handles instead of file descriptors, so that events of
+// closed file descriptors are never passed to the handlers of later registrations reusing them.
+// SIGPIPE is blocked on the reactor thread, so writing to the pipe of a killed process fails with
+// EPIPE instead of terminating the program.
+class ProcessReactor
+{
+	public:
+		using Handle = uint64_t;
+		// Receives the epoll events of the file descriptor
+		using Handler = std::function<void(uint32_t events)>;
+
+	public:
+		static ProcessReactor &instance();
+
+		~ProcessReactor();
+
+		// The file descriptor must stay open until it is removed
+		Handle add(int fileDescriptor, uint32_t events, Handler handler);
+		// Handlers may remove their own registrations
+		void remove(Handle handle, int fileDescriptor);
+
+	private:
+		ProcessReactor();
+
+		void run();
+
+		int m_epollFileDescriptor;
+		// Wakes up the reactor thread for shutting down
+		int m_wakeUpFileDescriptor;
+
+		std::mutex m_handlersMutex;
+		std::unordered_map<Handle, std::shared_ptr<Handler>> m_handlers;
+		Handle m_nextHandle;
+
+		std::thread m_thread;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
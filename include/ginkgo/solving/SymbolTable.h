@@ -1,30 +1,77 @@
 #ifndef __SOLVING__SYMBOL_TABLE_H
 #define __SOLVING__SYMBOL_TABLE_H
 
+#include <cstdint>
+#include <deque>
 #include <string>
-#include <unordered_map>
 #include <vector>
-#include <memory>
+
+#include <boost/utility/string_ref.hpp>
 
 namespace ginkgo
 {
 
-// Forward declarations
-class Literal;
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // SymbolTable
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Interns identifiers and terms in open-addressing hash tables with linear probing
+//
+// Symbols are dense IDs in the order the identifiers were first interned, and they never change, so
+// that they can be compared and hashed in place of the identifiers. Terms are hash-consed, so that
+// equal terms are stored once and can be compared by their addresses.
 class SymbolTable
 {
 	public:
-		const std::string *identifier(const std::string &identifier);
+		using Symbol = uint32_t;
+
+		// Symbol applied to a tuple of argument terms
+		struct Term
+		{
+			Symbol symbol;
+			// Dense ID in the order the terms were first interned
+			uint32_t id;
+			const std::string *name;
+			std::vector<const Term *> arguments;
+		};
+
+	public:
+		SymbolTable();
+
+		// Interns the identifier, which is only copied when it is new
+		Symbol symbol(boost::string_ref identifier);
+		// The reference stays valid as long as the symbol table exists
+		const std::string &name(Symbol symbol) const;
+
+		// Interns the term, which stays valid as long as the symbol table exists
+		const Term *term(Symbol symbol, const Term *const *arguments, size_t numberOfArguments);
+
+		size_t size() const;
+		size_t numberOfTerms() const;
 
 	private:
-		std::vector<std::unique_ptr<std::string>> m_identifiers;
+		struct Slot
+		{
+			// Upper bits of the hash, compared before the names
+			uint32_t hash;
+			// Symbol plus one, so that zero marks empty slots
+			uint32_t entry;
+		};
+
+		static uint64_t hash(boost::string_ref identifier);
+		static uint64_t hash(Symbol symbol, const Term *const *arguments, size_t numberOfArguments);
+
+		// Power-of-two size, kept at most half full
+		std::vector<Slot> m_slots;
+		// Names by symbol, which don't move when new symbols are added
+		std::deque<std::string> m_names;
+
+		std::vector<Slot> m_termSlots;
+		std::deque<Term> m_terms;
+		// Terms without arguments by symbol (null if not interned yet)
+		std::vector<const Term *> m_constants;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+#ifndef __UTILS__LINE_QUEUE_H
+#define __UTILS__LINE_QUEUE_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include <boost/utility/string_ref.hpp>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// LineQueue
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Lock-free queue passing lines of output from a single producer to a single consumer
+//
+// Lines are copied once into chunks of memory, which also hold the records of the lines. The
+// consumer receives views of the lines, and chunks are freed once the consumer has moved past them.
+class LineQueue
+{
+	public:
+		LineQueue();
+		~LineQueue();
+
+		LineQueue(const LineQueue &other) = delete;
+		LineQueue &operator=(const LineQueue &other) = delete;
+
+		// Splits the data at newlines and returns the number of published lines (producer only)
+		size_t append(const char *data, size_t size);
+		// Publishes the last line if it is not terminated by a newline (producer only)
+		bool flush();
+
+		// The view stays valid until the next call to pop (consumer only)
+		bool pop(boost::string_ref &line);
+
+		// Drops all lines (only while neither the producer nor the consumer is active)
+		void clear();
+
+	private:
+		static const size_t ChunkSize;
+		static const size_t RecordsPerChunk = 4096;
+
+		struct Record
+		{
+			size_t begin;
+			size_t size;
+		};
+
+		struct Chunk
+		{
+			Chunk(size_t capacity);
+
+			std::unique_ptr<char[]> bytes;
+			size_t capacity;
+			// Only accessed by the producer
+			size_t size;
+
+			std::array<Record, RecordsPerChunk> records;
+			std::atomic<size_t> numberOfRecords;
+			// Set once no further records are published in this chunk
+			std::atomic<Chunk *> next;
+		};
+
+		// Moves the unterminated line to a new chunk if the current one is full
+		void reserve(size_t size);
+		void publish();
+
+		// Consumer side
+		Chunk *m_head;
+		size_t m_nextRecord;
+
+		// Producer side
+		Chunk *m_tail;
+		size_t m_lineBegin;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+#endif
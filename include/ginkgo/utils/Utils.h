@@ -18,6 +18,8 @@ namespace ginkgo
 size_t findMatchingRightParenthesis(const std::string &string, size_t leftParenthesisPosition);
 bool isNumeric(char c);
 bool isAlphanumeric(char c);
+// Makes writing to the pipe of a terminated child process fail with EPIPE instead of raising SIGPIPE
+void ignoreBrokenPipes();
 
 auto identity =
 	[](auto predicate)
@@ -69,6 +69,12 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromRawFile(const boost::fi
 	const auto &timedEventsFeedbackExtracted = productionEvents.eventsFeedbackExtracted();
 	const auto &timedEventsMinimized = productionEvents.eventsMinimized();
 	const auto &timedEventsConstraintsRemoved = productionEvents.eventsConstraintsRemoved();
+	const auto &timedEventsProofCacheAccessed = productionEvents.eventsProofCacheAccessed();
+	const auto &timedEventsHypothesisRefuted = productionEvents.eventsHypothesisRefuted();
+	const auto &timedEventsFeedbackSimulated = productionEvents.eventsFeedbackSimulated();
+	const auto &timedEventsExplicitStateChecked = productionEvents.eventsExplicitStateChecked();
+	const auto &timedEventsProgramReduced = productionEvents.eventsProgramReduced();
+	const auto &timedEventsFluentClosurePrecomputed = productionEvents.eventsFluentClosurePrecomputed();
 
 	const auto &eventFinishedTime = std::get<0>(timedEventFinished);
 	const auto &eventFinished = std::get<1>(timedEventFinished);
@@ -79,12 +85,30 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromRawFile(const boost::fi
 	const auto purposeProve = production::EventHypothesisTested::Purpose::Prove;
 	const auto purposeMinimize = production::EventHypothesisTested::Purpose::Minimize;
 
+	// Induction base and step proofs may run concurrently, so a proven step only counts with a proven base
+	bool inductionBaseProven = false;
+
+	// The portfolio tests every hypothesis with a state-wise proof, and only the winning method counts
+	const auto isPortfolio = (productionAnalysis.configuration.proofMethod == production::ProofMethod::Portfolio);
+
 	std::for_each(timedEventsHypothesisTested.cbegin(), timedEventsHypothesisTested.cend(),
 		[&](const auto &timedEvent)
 		{
 			const auto &event = std::get<1>(timedEvent);
 
-			if (event.proofType == production::ProofType::StateWiseProof || event.proofType == production::ProofType::InductionBaseProof)
+			if (event.proofType == production::ProofType::InductionBaseProof)
+				inductionBaseProven = (event.proofResult == production::ProofResult::Proven);
+
+			const auto isFirstProof = (event.proofType == production::ProofType::StateWiseProof
+				|| (event.proofType == production::ProofType::InductionBaseProof && !isPortfolio));
+
+			const auto isWinningProof = isPortfolio
+				? ((event.proofType == production::ProofType::StateWiseProof && event.winningProofMethod == production::ProofMethod::StateWiseProof)
+					|| (event.proofType == production::ProofType::InductionStepProof && event.winningProofMethod == production::ProofMethod::InductionProof))
+				: (event.proofType == production::ProofType::StateWiseProof
+					|| (event.proofType == production::ProofType::InductionStepProof && inductionBaseProven));
+
+			if (isFirstProof)
 			{
 				if (event.purpose == purposeProve)
 				{
@@ -104,13 +128,22 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromRawFile(const boost::fi
 					productionAnalysis.minimizationProofs++;
 			}
 
-			if ((event.proofType == production::ProofType::StateWiseProof || event.proofType == production::ProofType::InductionStepProof)
-				&& event.proofResult == production::ProofResult::Proven)
+			if (isWinningProof && event.proofResult == production::ProofResult::Proven)
 			{
 				if (event.purpose == purposeProve)
 					productionAnalysis.proofsSuccessful++;
 				else if (event.purpose == purposeMinimize)
 					productionAnalysis.minimizationProofsSuccessful++;
+
+				if (isPortfolio && event.purpose == purposeProve)
+				{
+					if (event.winningProofMethod == production::ProofMethod::StateWiseProof)
+						productionAnalysis.portfolioWinsStateWise++;
+					else
+						productionAnalysis.portfolioWinsInduction++;
+
+					productionAnalysis.portfolioWinsPerDegree[event.hypothesisDegree][event.winningProofMethod]++;
+				}
 			}
 
 			if (event.purpose == purposeProve)
@@ -125,6 +158,58 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromRawFile(const boost::fi
 			}
 		});
 
+	// Info about reused proof results
+	std::for_each(timedEventsProofCacheAccessed.cbegin(), timedEventsProofCacheAccessed.cend(),
+		[&](const auto &timedEvent)
+		{
+			const auto &event = std::get<1>(timedEvent);
+
+			productionAnalysis.proofCacheHits += event.hit;
+			productionAnalysis.proofCacheMisses += !event.hit;
+		});
+
+	productionAnalysis.counterexampleRefutations = timedEventsHypothesisRefuted.size();
+
+	// Info about hypotheses refuted by simulation
+	std::for_each(timedEventsFeedbackSimulated.cbegin(), timedEventsFeedbackSimulated.cend(),
+		[&](const auto &timedEvent)
+		{
+			const auto &event = std::get<1>(timedEvent);
+
+			productionAnalysis.simulationRefutations += event.refutedHypotheses;
+			productionAnalysis.simulationTimeTotal += event.simulationTime;
+		});
+
+	// Info about hypotheses decided without solving
+	std::for_each(timedEventsExplicitStateChecked.cbegin(), timedEventsExplicitStateChecked.cend(),
+		[&](const auto &timedEvent)
+		{
+			const auto &event = std::get<1>(timedEvent);
+
+			productionAnalysis.explicitStateChecks++;
+			productionAnalysis.explicitStateCheckTimeTotal += event.checkTime;
+		});
+
+	// Info about the relevance analysis
+	std::for_each(timedEventsProgramReduced.cbegin(), timedEventsProgramReduced.cend(),
+		[&](const auto &timedEvent)
+		{
+			const auto &event = std::get<1>(timedEvent);
+
+			if (event.facts > 0)
+				productionAnalysis.programReduction = static_cast<double>(event.reducedFacts) / event.facts;
+		});
+
+	// Info about the fluent closure
+	std::for_each(timedEventsFluentClosurePrecomputed.cbegin(), timedEventsFluentClosurePrecomputed.cend(),
+		[&](const auto &timedEvent)
+		{
+			const auto &event = std::get<1>(timedEvent);
+
+			productionAnalysis.fluentClosurePrecomputed = true;
+			productionAnalysis.fluentClosurePrecomputationTime += event.precomputationTime;
+		});
+
 	// Info about skipped hypotheses
 	std::for_each(timedEventsConstraintsRemoved.cbegin(), timedEventsConstraintsRemoved.cend(),
 		[&](const auto &timedEvent)
@@ -167,6 +252,7 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromRawFile(const boost::fi
 			productionAnalysis.minimizationLiteralsTotal += event.remainingLiterals + event.removedLiterals;
 			productionAnalysis.minimizationLiteralsRemoved += event.removedLiterals;
 			productionAnalysis.minimizationTests += event.requiredTests;
+			productionAnalysis.minimizationSpeculativeTests += event.speculativeTests;
 		});
 
 	productionAnalysis.penalty = penalty;
@@ -198,6 +284,27 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromAnalysisFile(const boos
 	productionAnalysis.proofTimeGroundingTotal = json["ProofTimeGroundingTotal"].asDouble();
 	productionAnalysis.proofTimeSolvingTotal = json["ProofTimeSolvingTotal"].asDouble();
 
+	productionAnalysis.proofCacheHits = static_cast<size_t>(json["ProofCacheHits"].asUInt64());
+	productionAnalysis.proofCacheMisses = static_cast<size_t>(json["ProofCacheMisses"].asUInt64());
+	productionAnalysis.counterexampleRefutations = static_cast<size_t>(json["CounterexampleRefutations"].asUInt64());
+	productionAnalysis.simulationRefutations = static_cast<size_t>(json["SimulationRefutations"].asUInt64());
+	productionAnalysis.simulationTimeTotal = json["SimulationTimeTotal"].asDouble();
+	productionAnalysis.explicitStateChecks = static_cast<size_t>(json["ExplicitStateChecks"].asUInt64());
+	productionAnalysis.explicitStateCheckTimeTotal = json["ExplicitStateCheckTimeTotal"].asDouble();
+	productionAnalysis.programReduction = json.get("ProgramReduction", 1.0).asDouble();
+	productionAnalysis.fluentClosurePrecomputed = json["FluentClosurePrecomputed"].asBool();
+	productionAnalysis.fluentClosurePrecomputationTime = json["FluentClosurePrecomputationTime"].asDouble();
+
+	productionAnalysis.portfolioWinsStateWise = static_cast<size_t>(json["PortfolioWinsStateWise"].asUInt64());
+	productionAnalysis.portfolioWinsInduction = static_cast<size_t>(json["PortfolioWinsInduction"].asUInt64());
+
+	const auto &jsonPortfolioWinsPerDegree = json["PortfolioWinsPerDegree"];
+
+	for (const auto &degree : jsonPortfolioWinsPerDegree.getMemberNames())
+		for (const auto &proofMethod : jsonPortfolioWinsPerDegree[degree].getMemberNames())
+			productionAnalysis.portfolioWinsPerDegree[std::stoul(degree)][fromString<production::ProofMethod>(proofMethod)] =
+				static_cast<size_t>(jsonPortfolioWinsPerDegree[degree][proofMethod].asUInt64());
+
 	productionAnalysis.minimizationProofs = static_cast<size_t>(json["MinimizationProofs"].asUInt64());
 	productionAnalysis.minimizationProofsSuccessful = static_cast<size_t>(json["MinimizationProofsSuccessful"].asUInt64());
 	productionAnalysis.minimizationProofTimeGroundingTotal = json["MinimizationProofTimeGroundingTotal"].asDouble();
@@ -206,6 +313,7 @@ ProductionAnalysis<Plain> ProductionAnalysis<Plain>::fromAnalysisFile(const boos
 	productionAnalysis.minimizationLiteralsTotal = static_cast<size_t>(json["MinimizationLiteralsTotal"].asUInt64());
 	productionAnalysis.minimizationLiteralsRemoved = static_cast<size_t>(json["MinimizationLiteralsRemoved"].asUInt64());
 	productionAnalysis.minimizationTests = static_cast<size_t>(json["MinimizationTests"].asUInt64());
+	productionAnalysis.minimizationSpeculativeTests = static_cast<size_t>(json["MinimizationSpeculativeTests"].asUInt64());
 
 	productionAnalysis.hypothesisDegreeMin = static_cast<size_t>(json["HypothesisDegreeMin"].asUInt64());
 	productionAnalysis.hypothesisDegreeTotal = static_cast<size_t>(json["HypothesisDegreeTotal"].asUInt64());
@@ -245,6 +353,20 @@ ProductionAnalysis<Plain>::ProductionAnalysis()
 	proofTimeGroundingTotal = 0.0;
 	proofTimeSolvingTotal = 0.0;
 
+	proofCacheHits = 0;
+	proofCacheMisses = 0;
+	counterexampleRefutations = 0;
+	simulationRefutations = 0;
+	simulationTimeTotal = 0.0;
+	explicitStateChecks = 0;
+	explicitStateCheckTimeTotal = 0.0;
+	programReduction = 1.0;
+	fluentClosurePrecomputed = false;
+	fluentClosurePrecomputationTime = 0.0;
+
+	portfolioWinsStateWise = 0;
+	portfolioWinsInduction = 0;
+
 	minimizationProofs = 0;
 	minimizationProofsSuccessful = 0;
 	minimizationProofTimeGroundingTotal = 0.0;
@@ -253,6 +375,7 @@ ProductionAnalysis<Plain>::ProductionAnalysis()
 	minimizationLiteralsTotal = 0;
 	minimizationLiteralsRemoved = 0;
 	minimizationTests = 0;
+	minimizationSpeculativeTests = 0;
 
 	hypothesisDegreeMin = std::numeric_limits<size_t>::max();
 	hypothesisDegreeTotal = 0;
@@ -293,12 +416,34 @@ void ProductionAnalysis<Plain>::write(const boost::filesystem::path &path) const
 	json["ProofTimeGroundingTotal"] = proofTimeGroundingTotal;
 	json["ProofTimeSolvingTotal"] = proofTimeSolvingTotal;
 
+	json["ProofCacheHits"] = static_cast<Json::UInt64>(proofCacheHits);
+	json["ProofCacheMisses"] = static_cast<Json::UInt64>(proofCacheMisses);
+	json["CounterexampleRefutations"] = static_cast<Json::UInt64>(counterexampleRefutations);
+	json["SimulationRefutations"] = static_cast<Json::UInt64>(simulationRefutations);
+	json["SimulationTimeTotal"] = simulationTimeTotal;
+	json["ExplicitStateChecks"] = static_cast<Json::UInt64>(explicitStateChecks);
+	json["ExplicitStateCheckTimeTotal"] = explicitStateCheckTimeTotal;
+	json["ProgramReduction"] = programReduction;
+	json["FluentClosurePrecomputed"] = fluentClosurePrecomputed;
+	json["FluentClosurePrecomputationTime"] = fluentClosurePrecomputationTime;
+
+	json["PortfolioWinsStateWise"] = static_cast<Json::UInt64>(portfolioWinsStateWise);
+	json["PortfolioWinsInduction"] = static_cast<Json::UInt64>(portfolioWinsInduction);
+
+	auto &jsonPortfolioWinsPerDegree = json["PortfolioWinsPerDegree"];
+	jsonPortfolioWinsPerDegree = Json::objectValue;
+
+	for (const auto &portfolioWins : portfolioWinsPerDegree)
+		for (const auto &wins : portfolioWins.second)
+			jsonPortfolioWinsPerDegree[std::to_string(portfolioWins.first)][toString(wins.first)] = static_cast<Json::UInt64>(wins.second);
+
 	json["MinimizationProofs"] = static_cast<Json::UInt64>(minimizationProofs);
 	json["MinimizationProofsSuccessful"] = static_cast<Json::UInt64>(minimizationProofsSuccessful);
 	json["MinimizationProofTimeGroundingTotal"] = minimizationProofTimeGroundingTotal;
 	json["MinimizationProofTimeSolvingTotal"] = minimizationProofTimeSolvingTotal;
 
 	json["MinimizationTests"] = static_cast<Json::UInt64>(minimizationTests);
+	json["MinimizationSpeculativeTests"] = static_cast<Json::UInt64>(minimizationSpeculativeTests);
 	json["MinimizationLiteralsTotal"] = static_cast<Json::UInt64>(minimizationLiteralsTotal);
 	json["MinimizationLiteralsRemoved"] = static_cast<Json::UInt64>(minimizationLiteralsRemoved);
 
@@ -21,6 +21,7 @@ BenchmarkEnvironment::BenchmarkEnvironment(boost::filesystem::path filePrefix)
 	m_feedbackType{FeedbackType::Unknown},
 	m_horizon{0},
 	m_maxNumberOfConstraints{0},
+	m_pipelining{false},
 	m_productionStatisticsStream(m_filePrefix.string() + ".stats-produce", std::ios::in)
 {
 }
@@ -108,6 +109,20 @@ size_t BenchmarkEnvironment::maxNumberOfConstraints() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void BenchmarkEnvironment::setPipelining(bool pipelining)
+{
+	m_pipelining = pipelining;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BenchmarkEnvironment::pipelining() const
+{
+	return m_pipelining;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 std::ifstream &BenchmarkEnvironment::constraintsStream()
 {
 	return m_constraintsStream;
@@ -1,10 +1,12 @@
 #include <ginkgo/feedback-loop/consumption/BenchmarkRunner.h>
 
+#include <algorithm>
 #include <iostream>
 #include <json/json.h>
 
 #include <ginkgo/utils/TextFile.h>
 #include <ginkgo/feedback-loop/production/FeedbackLoop.h>
+#include <ginkgo/feedback-loop/production/RelevanceAnalysis.h>
 
 namespace ginkgo
 {
@@ -20,7 +22,8 @@ namespace consumption
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 BenchmarkRunner::BenchmarkRunner(std::unique_ptr<BenchmarkEnvironment> environment)
-:	m_environment(std::move(environment))
+:	m_environment(std::move(environment)),
+	m_programReduction{1.0}
 {
 	Json::Value productionStatistics;
 	m_environment->productionStatisticsStream() >> productionStatistics;
@@ -36,6 +39,10 @@ BenchmarkRunner::BenchmarkRunner(std::unique_ptr<BenchmarkEnvironment> environme
 
 	m_environment->productionStatisticsStream().close();
 
+	// Benchmark the instance the constraints were learned from
+	if (m_productionConfiguration.reduceProgram)
+		reduceProgram();
+
 	std::string line;
 
 	BOOST_ASSERT_MSG(m_environment->feedbackType() != FeedbackType::Unknown, "Feedback type unspecified");
@@ -52,6 +59,41 @@ BenchmarkRunner::BenchmarkRunner(std::unique_ptr<BenchmarkEnvironment> environme
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void BenchmarkRunner::reduceProgram()
+{
+	std::vector<std::string> atoms;
+
+	if (!production::RelevanceAnalysis::computeFacts(m_program.str(), atoms))
+	{
+		std::cout << "[Warn ] Instance and domain are not plain facts, benchmarking without relevance analysis" << std::endl;
+		return;
+	}
+
+	SymbolTable symbolTable;
+	std::unique_ptr<production::RelevanceAnalysis> relevanceAnalysis;
+
+	try
+	{
+		relevanceAnalysis = std::make_unique<production::RelevanceAnalysis>(atoms, symbolTable);
+	}
+	catch (const std::exception &e)
+	{
+		std::cout << "[Warn ] Could not analyze instance and domain facts: " << e.what() << std::endl;
+		return;
+	}
+
+	m_program.str(relevanceAnalysis->reducedProgram());
+	m_program.clear();
+
+	m_programReduction = static_cast<double>(relevanceAnalysis->numberOfReducedFacts())
+		/ std::max<size_t>(relevanceAnalysis->numberOfFacts(), 1);
+
+	std::cout << "[Info ] Reduced instance to " << relevanceAnalysis->numberOfReducedFacts() << "/"
+		<< relevanceAnalysis->numberOfFacts() << " facts" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void BenchmarkRunner::run()
 {
 	setlocale(LC_NUMERIC, "C");
@@ -86,17 +128,42 @@ void BenchmarkRunner::run()
 			metaEncoding.clear();
 			metaEncoding.seekg(0, std::ios::beg);
 
-			const auto groundingStartTime = std::chrono::high_resolution_clock::now();
-
 			AsyncProcess gringo(m_environment->gringoConfiguration());
+			AsyncProcess clasp(m_environment->claspConfiguration());
+
+			double groundingTime = 0.0;
+
+			// Once grounding timed out, larger numbers of constraints are not measured anymore
+			if (groundingTimeout)
+				groundingTime = 0.0;
+			// clasp limits its own solving time, so only grounding has a timeout
+			else if (m_environment->pipelining())
+			{
+				Encoding encoding;
+				encoding.append(metaEncoding.str());
+
+				bool solvingTimeout = false;
 
-			if (!groundingTimeout)
+				AsyncProcess::runPipeline(gringo, clasp, encoding, std::chrono::minutes(10), groundingTimeout,
+					std::chrono::milliseconds(0), solvingTimeout, groundingTime);
+			}
+			else
 			{
+				const auto groundingStartTime = std::chrono::high_resolution_clock::now();
+
 				gringo.run(metaEncoding, std::chrono::minutes(10), groundingTimeout);
 				gringo.join();
-			}
 
-			const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+				const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+				groundingTime = std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count();
+
+				if (!groundingTimeout)
+				{
+					BOOST_ASSERT(gringo.stdout());
+					clasp.run(*gringo.stdout());
+					clasp.join();
+				}
+			}
 
 			Json::Value output;
 
@@ -108,19 +175,22 @@ void BenchmarkRunner::run()
 			}
 			else
 			{
-				AsyncProcess clasp(m_environment->claspConfiguration());
-				BOOST_ASSERT(gringo.stdout());
-				clasp.run(*gringo.stdout());
-				clasp.join();
-
 				*clasp.stdout() >> output;
 				output["Ginkgo"]["GroundingTimeout"] = false;
 
+				// In a pipeline, clasp runs alongside gringo, so its total time includes the grounding time
+				if (m_environment->pipelining())
+				{
+					auto &totalTime = output["Time"]["Total"];
+					totalTime = std::max(0.0, totalTime.asDouble() - groundingTime);
+				}
+
 				std::cout << "[Info ] Measured " << numberOfConstraints << "/" << m_constraints.size() << std::endl;
 			}
 
 			output["Ginkgo"]["SelectedConstraints"] = static_cast<Json::UInt64>(numberOfConstraints);
-			output["Ginkgo"]["GroundingTime"] = std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count();
+			output["Ginkgo"]["GroundingTime"] = groundingTime;
+			output["Ginkgo"]["ProgramReduction"] = m_programReduction;
 			m_environment->consumptionStatisticsStream() << Json::FastWriter().write(output) << std::flush;
 		};
 
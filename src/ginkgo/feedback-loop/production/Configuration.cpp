@@ -25,6 +25,18 @@ Configuration<Plain>::Configuration()
 	testingPolicy = TestingPolicy::FindFirst;
 	minimizationStrategy = MinimizationStrategy::NoMinimization;
 	fluentClosureUsage = FluentClosureUsage::NoFluentClosure;
+	solverBackend = SolverBackend::Process;
+	pipelineProcesses = false;
+	proofWorkers = 1;
+	speculativeMinimizationCandidates = 1;
+	proofBatchSize = 1;
+	pregroundTransitionSystems = false;
+	keepCounterexamples = false;
+	reduceProgram = false;
+	precomputeFluentClosure = false;
+	simulatedWalks = 0;
+	explicitStateChecking = ExplicitStateChecking::NoExplicitStateChecking;
+	explicitStateBound = 0;
 	constraintsToExtract = 128;
 	constraintsToProve = 1;
 	maxDegree = std::numeric_limits<decltype(maxDegree)>::max();
@@ -63,6 +75,44 @@ Configuration<Plain> Configuration<Plain>::fromJSON(const Json::Value &json)
 	configuration.testingPolicy = fromString<TestingPolicy>(json["TestingPolicy"].asString());
 	configuration.minimizationStrategy = fromString<MinimizationStrategy>(json["MinimizationStrategy"].asString());
 	configuration.fluentClosureUsage = fromString<FluentClosureUsage>(json["FluentClosureUsage"].asString());
+
+	// TODO: Remove legacy support
+	if (json.get("SolverBackend", Json::nullValue) != Json::nullValue)
+		configuration.solverBackend = fromString<SolverBackend>(json["SolverBackend"].asString());
+
+	if (json.get("PipelineProcesses", Json::nullValue) != Json::nullValue)
+		configuration.pipelineProcesses = json["PipelineProcesses"].asBool();
+
+	if (json.get("ProofWorkers", Json::nullValue) != Json::nullValue)
+		configuration.proofWorkers = json["ProofWorkers"].asUInt64();
+
+	if (json.get("SpeculativeMinimizationCandidates", Json::nullValue) != Json::nullValue)
+		configuration.speculativeMinimizationCandidates = json["SpeculativeMinimizationCandidates"].asUInt64();
+
+	if (json.get("ProofBatchSize", Json::nullValue) != Json::nullValue)
+		configuration.proofBatchSize = json["ProofBatchSize"].asUInt64();
+
+	if (json.get("PregroundTransitionSystems", Json::nullValue) != Json::nullValue)
+		configuration.pregroundTransitionSystems = json["PregroundTransitionSystems"].asBool();
+
+	if (json.get("KeepCounterexamples", Json::nullValue) != Json::nullValue)
+		configuration.keepCounterexamples = json["KeepCounterexamples"].asBool();
+
+	if (json.get("ReduceProgram", Json::nullValue) != Json::nullValue)
+		configuration.reduceProgram = json["ReduceProgram"].asBool();
+
+	if (json.get("PrecomputeFluentClosure", Json::nullValue) != Json::nullValue)
+		configuration.precomputeFluentClosure = json["PrecomputeFluentClosure"].asBool();
+
+	if (json.get("SimulatedWalks", Json::nullValue) != Json::nullValue)
+		configuration.simulatedWalks = json["SimulatedWalks"].asUInt64();
+
+	if (json.get("ExplicitStateChecking", Json::nullValue) != Json::nullValue)
+		configuration.explicitStateChecking = fromString<ExplicitStateChecking>(json["ExplicitStateChecking"].asString());
+
+	if (json.get("ExplicitStateBound", Json::nullValue) != Json::nullValue)
+		configuration.explicitStateBound = json["ExplicitStateBound"].asUInt64();
+
 	configuration.constraintsToExtract = json["ConstraintsToExtract"].asUInt64();
 	configuration.constraintsToProve = json["ConstraintsToProve"].asUInt64();
 	configuration.maxDegree = json["MaxDegree"].asUInt64();
@@ -90,6 +140,18 @@ Json::Value Configuration<Plain>::toJSON() const
 	json["TestingPolicy"] = toString(testingPolicy);
 	json["MinimizationStrategy"] = toString(minimizationStrategy);
 	json["FluentClosureUsage"] = toString(fluentClosureUsage);
+	json["SolverBackend"] = toString(solverBackend);
+	json["PipelineProcesses"] = static_cast<bool>(pipelineProcesses);
+	json["ProofWorkers"] = static_cast<Json::UInt64>(proofWorkers);
+	json["SpeculativeMinimizationCandidates"] = static_cast<Json::UInt64>(speculativeMinimizationCandidates);
+	json["ProofBatchSize"] = static_cast<Json::UInt64>(proofBatchSize);
+	json["PregroundTransitionSystems"] = static_cast<bool>(pregroundTransitionSystems);
+	json["KeepCounterexamples"] = static_cast<bool>(keepCounterexamples);
+	json["ReduceProgram"] = static_cast<bool>(reduceProgram);
+	json["PrecomputeFluentClosure"] = static_cast<bool>(precomputeFluentClosure);
+	json["SimulatedWalks"] = static_cast<Json::UInt64>(simulatedWalks);
+	json["ExplicitStateChecking"] = toString(explicitStateChecking);
+	json["ExplicitStateBound"] = static_cast<Json::UInt64>(explicitStateBound);
 	json["ConstraintsToExtract"] = static_cast<Json::UInt64>(constraintsToExtract);
 	json["ConstraintsToProve"] = static_cast<Json::UInt64>(constraintsToProve);
 	json["MaxDegree"] = static_cast<Json::UInt64>(maxDegree);
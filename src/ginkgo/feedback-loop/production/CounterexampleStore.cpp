@@ -0,0 +1,251 @@
+#include <ginkgo/feedback-loop/production/CounterexampleStore.h>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#include <boost/assert.hpp>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CounterexampleStore
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const size_t CounterexampleStore::Capacity = 1024;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Prints a literal without its sign and time argument
+static std::string atom(const Literal &literal)
+{
+	const auto &arguments = literal.arguments();
+
+	std::stringstream atom;
+	atom << *literal.name() << "(";
+
+	for (size_t i = 0; i < arguments.size(); i++)
+	{
+		if (i != 0)
+			atom << ", ";
+
+		atom << arguments[i];
+	}
+
+	atom << ")";
+
+	return atom.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool isTraceLiteral(const Literal &literal)
+{
+	if (!literal.hasTimeArgument())
+		return false;
+
+	const auto &name = *literal.name();
+
+	return name == "holds" || name == "apply" || name == "del";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CounterexampleStore::CounterexampleStore(SymbolTable &symbolTable)
+:	m_symbolTable(symbolTable),
+	m_isDisabled{false}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CounterexampleStore::insert(const Counterexample &counterexample)
+{
+	if (m_isDisabled || counterexample.atoms.empty())
+		return;
+
+	Trace trace;
+	trace.startsInInitialState = counterexample.startsInInitialState;
+	trace.timeSteps.resize(counterexample.horizon + 1);
+
+	try
+	{
+		std::for_each(counterexample.atoms.cbegin(), counterexample.atoms.cend(), [&](const auto &string)
+		{
+			size_t position = 0;
+			const Literal literal(string, position, m_symbolTable);
+
+			// Only keep the time steps covered by the proof
+			if (!isTraceLiteral(literal) || literal.timeArgument() > counterexample.horizon)
+				return;
+
+			trace.timeSteps[literal.timeArgument()].insert(atom(literal));
+		});
+	}
+	catch (const std::exception &e)
+	{
+		std::cout << "[Warn ] Could not read counterexample: " << e.what() << std::endl;
+		return;
+	}
+
+	// Proofs started before the latest constraints were learned may have found outdated traces
+	for (const auto &learnedConstraint : m_learnedConstraints)
+		for (size_t t = 0; t + learnedConstraint.degree <= counterexample.horizon; t++)
+			if (isViolated(learnedConstraint, trace, t))
+				return;
+
+	if (m_traces.size() >= Capacity)
+		m_traces.pop_front();
+
+	m_traces.push_back(std::move(trace));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CounterexampleStore::addLearnedConstraint(const Constraint &learnedConstraint)
+{
+	if (m_isDisabled)
+		return;
+
+	Pattern pattern;
+
+	if (!makePattern(learnedConstraint, pattern))
+	{
+		m_traces.clear();
+		m_learnedConstraints.clear();
+		m_isDisabled = true;
+		return;
+	}
+
+	m_traces.erase(std::remove_if(m_traces.begin(), m_traces.end(), [&](const auto &trace)
+	{
+		for (size_t t = 0; t + pattern.degree < trace.timeSteps.size(); t++)
+			if (isViolated(pattern, trace, t))
+				return true;
+
+		return false;
+	}), m_traces.end());
+
+	m_learnedConstraints.push_back(std::move(pattern));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CounterexampleStore::refutes(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod) const
+{
+	if (m_traces.empty())
+		return false;
+
+	Pattern pattern;
+
+	if (!makePattern(*hypothesis.originalConstraint(), pattern))
+		return false;
+
+	switch (proofMethod)
+	{
+		case ProofMethod::StateWiseProof:
+			return refutesStateWiseProof(pattern);
+		case ProofMethod::InductionProof:
+			return refutesInductionProof(pattern);
+		case ProofMethod::Portfolio:
+			return refutesStateWiseProof(pattern) && refutesInductionProof(pattern);
+		default:
+			return false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t CounterexampleStore::size() const
+{
+	return m_traces.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CounterexampleStore::makePattern(const Constraint &constraint, Pattern &pattern)
+{
+	const auto &literals = constraint.literals();
+
+	if (literals.empty() || !std::all_of(literals.cbegin(), literals.cend(), isTraceLiteral))
+		return false;
+
+	const auto timeRange = constraint.timeRange();
+	const auto &timeMin = std::get<0>(timeRange);
+	const auto &timeMax = std::get<1>(timeRange);
+
+	pattern.degree = timeMax - timeMin;
+	pattern.literals.clear();
+	pattern.literals.reserve(literals.size());
+
+	std::transform(literals.cbegin(), literals.cend(), std::back_inserter(pattern.literals),
+		[&](const auto &literal) -> PatternLiteral
+		{
+			return {literal.timeArgument() - timeMin, literal.sign(), atom(literal)};
+		});
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CounterexampleStore::isViolated(const Pattern &pattern, const Trace &trace, size_t time)
+{
+	BOOST_ASSERT(time + pattern.degree < trace.timeSteps.size());
+
+	return std::all_of(pattern.literals.cbegin(), pattern.literals.cend(), [&](const auto &literal)
+	{
+		const auto &timeStep = trace.timeSteps[time + literal.time];
+
+		return (timeStep.find(literal.atom) != timeStep.end()) == literal.sign;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CounterexampleStore::refutesStateWiseProof(const Pattern &hypothesis) const
+{
+	return std::any_of(m_traces.cbegin(), m_traces.cend(), [&](const auto &trace)
+	{
+		for (size_t t = 0; t + hypothesis.degree < trace.timeSteps.size(); t++)
+			if (isViolated(hypothesis, trace, t))
+				return true;
+
+		return false;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CounterexampleStore::refutesInductionProof(const Pattern &hypothesis) const
+{
+	return std::any_of(m_traces.cbegin(), m_traces.cend(), [&](const auto &trace)
+	{
+		// Base case
+		if (trace.startsInInitialState && hypothesis.degree < trace.timeSteps.size()
+			&& isViolated(hypothesis, trace, 0))
+		{
+			return true;
+		}
+
+		// Induction step
+		for (size_t t = 0; t + hypothesis.degree + 1 < trace.timeSteps.size(); t++)
+			if (!isViolated(hypothesis, trace, t) && isViolated(hypothesis, trace, t + 1))
+				return true;
+
+		return false;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -0,0 +1,52 @@
+#include <ginkgo/feedback-loop/production/EventExplicitStateChecked.h>
+
+#include <iostream>
+
+#include <ginkgo/utils/Utils.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventExplicitStateChecked
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventExplicitStateChecked EventExplicitStateChecked::fromJSON(const Json::Value &json)
+{
+	EventExplicitStateChecked result;
+
+	result.purpose = fromString<EventHypothesisTested::Purpose>(json["Purpose"].asString());
+	result.hypothesisDegree = json["HypothesisDegree"].asUInt64();
+	result.hypothesisLiterals = json["HypothesisLiterals"].asUInt64();
+	result.proofResult = fromString<ProofResult>(json["ProofResult"].asString());
+	result.checkTime = json["CheckTime"].asDouble();
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Json::Value EventExplicitStateChecked::toJSON() const
+{
+	Json::Value result;
+
+	result["Purpose"] = toString(purpose);
+	result["HypothesisDegree"] = static_cast<Json::UInt64>(hypothesisDegree);
+	result["HypothesisLiterals"] = static_cast<Json::UInt64>(hypothesisLiterals);
+	result["ProofResult"] = toString(proofResult);
+	result["CheckTime"] = checkTime;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
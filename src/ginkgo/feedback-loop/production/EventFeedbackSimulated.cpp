@@ -0,0 +1,48 @@
+#include <ginkgo/feedback-loop/production/EventFeedbackSimulated.h>
+
+#include <iostream>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventFeedbackSimulated
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventFeedbackSimulated EventFeedbackSimulated::fromJSON(const Json::Value &json)
+{
+	EventFeedbackSimulated result;
+
+	result.testedHypotheses = json["TestedHypotheses"].asUInt64();
+	result.refutedHypotheses = json["RefutedHypotheses"].asUInt64();
+	result.traces = json["Traces"].asUInt64();
+	result.simulationTime = json["SimulationTime"].asDouble();
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Json::Value EventFeedbackSimulated::toJSON() const
+{
+	Json::Value result;
+
+	result["TestedHypotheses"] = static_cast<Json::UInt64>(testedHypotheses);
+	result["RefutedHypotheses"] = static_cast<Json::UInt64>(refutedHypotheses);
+	result["Traces"] = static_cast<Json::UInt64>(traces);
+	result["SimulationTime"] = simulationTime;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
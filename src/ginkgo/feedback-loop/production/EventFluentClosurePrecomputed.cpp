@@ -0,0 +1,44 @@
+#include <ginkgo/feedback-loop/production/EventFluentClosurePrecomputed.h>
+
+#include <iostream>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventFluentClosurePrecomputed
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventFluentClosurePrecomputed EventFluentClosurePrecomputed::fromJSON(const Json::Value &json)
+{
+	EventFluentClosurePrecomputed result;
+
+	result.fluents = json["Fluents"].asUInt64();
+	result.precomputationTime = json["PrecomputationTime"].asDouble();
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Json::Value EventFluentClosurePrecomputed::toJSON() const
+{
+	Json::Value result;
+
+	result["Fluents"] = static_cast<Json::UInt64>(fluents);
+	result["PrecomputationTime"] = precomputationTime;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -0,0 +1,50 @@
+#include <ginkgo/feedback-loop/production/EventHypothesisRefuted.h>
+
+#include <iostream>
+
+#include <ginkgo/utils/Utils.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventHypothesisRefuted
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventHypothesisRefuted EventHypothesisRefuted::fromJSON(const Json::Value &json)
+{
+	EventHypothesisRefuted result;
+
+	result.purpose = fromString<EventHypothesisTested::Purpose>(json["Purpose"].asString());
+	result.hypothesisDegree = json["HypothesisDegree"].asUInt64();
+	result.hypothesisLiterals = json["HypothesisLiterals"].asUInt64();
+	result.counterexamples = json["Counterexamples"].asUInt64();
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Json::Value EventHypothesisRefuted::toJSON() const
+{
+	Json::Value result;
+
+	result["Purpose"] = toString(purpose);
+	result["HypothesisDegree"] = static_cast<Json::UInt64>(hypothesisDegree);
+	result["HypothesisLiterals"] = static_cast<Json::UInt64>(hypothesisLiterals);
+	result["Counterexamples"] = static_cast<Json::UInt64>(counterexamples);
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
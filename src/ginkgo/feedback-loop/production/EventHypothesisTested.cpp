@@ -29,6 +29,16 @@ EventHypothesisTested EventHypothesisTested::fromJSON(const Json::Value &json)
 	result.hypothesisDegree = json["HypothesisDegree"].asUInt64();
 	result.hypothesisLiterals = json["HypothesisLiterals"].asUInt64();
 	result.proofResult = fromString<ProofResult>(json["ProofResult"].asString());
+	result.cancelled = false;
+
+	if (json.get("Cancelled", Json::nullValue) != Json::nullValue)
+		result.cancelled = json["Cancelled"].asBool();
+
+	result.winningProofMethod = ProofMethod::Unknown;
+
+	if (json.get("WinningProofMethod", Json::nullValue) != Json::nullValue)
+		result.winningProofMethod = fromString<ProofMethod>(json["WinningProofMethod"].asString());
+
 	result.groundingTime = json["GroundingTime"].asDouble();
 	result.claspJSONOutput = json["ClaspOutput"];
 
@@ -46,6 +56,8 @@ Json::Value EventHypothesisTested::toJSON() const
 	result["HypothesisDegree"] = static_cast<Json::UInt64>(hypothesisDegree);
 	result["HypothesisLiterals"] = static_cast<Json::UInt64>(hypothesisLiterals);
 	result["ProofResult"] = toString(proofResult);
+	result["Cancelled"] = cancelled;
+	result["WinningProofMethod"] = toString(winningProofMethod);
 	result["GroundingTime"] = groundingTime;
 	result["ClaspOutput"] = claspJSONOutput;
 
@@ -25,6 +25,12 @@ EventMinimized EventMinimized::fromJSON(const Json::Value &json)
 	result.finalDegree = json["FinalDegree"].asUInt64();
 	result.requiredTests = json["RequiredTests"].asUInt64();
 
+	// TODO: Remove legacy support
+	if (json.get("SpeculativeTests", Json::nullValue) != Json::nullValue)
+		result.speculativeTests = json["SpeculativeTests"].asUInt64();
+	else
+		result.speculativeTests = 0;
+
 	return result;
 }
 
@@ -39,6 +45,7 @@ Json::Value EventMinimized::toJSON() const
 	result["DecreasedDegree"] = static_cast<Json::UInt64>(decreasedDegree);
 	result["FinalDegree"] = static_cast<Json::UInt64>(finalDegree);
 	result["RequiredTests"] = static_cast<Json::UInt64>(requiredTests);
+	result["SpeculativeTests"] = static_cast<Json::UInt64>(speculativeTests);
 
 	return result;
 }
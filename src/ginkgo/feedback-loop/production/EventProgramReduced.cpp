@@ -0,0 +1,56 @@
+#include <ginkgo/feedback-loop/production/EventProgramReduced.h>
+
+#include <iostream>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventProgramReduced
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventProgramReduced EventProgramReduced::fromJSON(const Json::Value &json)
+{
+	EventProgramReduced result;
+
+	result.facts = json["Facts"].asUInt64();
+	result.reducedFacts = json["ReducedFacts"].asUInt64();
+	result.fluents = json["Fluents"].asUInt64();
+	result.reachableFluents = json["ReachableFluents"].asUInt64();
+	result.staticFluents = json["StaticFluents"].asUInt64();
+	result.actions = json["Actions"].asUInt64();
+	result.reachableActions = json["ReachableActions"].asUInt64();
+	result.reductionTime = json["ReductionTime"].asDouble();
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Json::Value EventProgramReduced::toJSON() const
+{
+	Json::Value result;
+
+	result["Facts"] = static_cast<Json::UInt64>(facts);
+	result["ReducedFacts"] = static_cast<Json::UInt64>(reducedFacts);
+	result["Fluents"] = static_cast<Json::UInt64>(fluents);
+	result["ReachableFluents"] = static_cast<Json::UInt64>(reachableFluents);
+	result["StaticFluents"] = static_cast<Json::UInt64>(staticFluents);
+	result["Actions"] = static_cast<Json::UInt64>(actions);
+	result["ReachableActions"] = static_cast<Json::UInt64>(reachableActions);
+	result["ReductionTime"] = reductionTime;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -0,0 +1,52 @@
+#include <ginkgo/feedback-loop/production/EventProofCacheAccessed.h>
+
+#include <iostream>
+
+#include <ginkgo/utils/Utils.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EventProofCacheAccessed
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EventProofCacheAccessed EventProofCacheAccessed::fromJSON(const Json::Value &json)
+{
+	EventProofCacheAccessed result;
+
+	result.purpose = fromString<EventHypothesisTested::Purpose>(json["Purpose"].asString());
+	result.hypothesisDegree = json["HypothesisDegree"].asUInt64();
+	result.hypothesisLiterals = json["HypothesisLiterals"].asUInt64();
+	result.hit = json["Hit"].asBool();
+	result.proofResult = fromString<ProofResult>(json["ProofResult"].asString());
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Json::Value EventProofCacheAccessed::toJSON() const
+{
+	Json::Value result;
+
+	result["Purpose"] = toString(purpose);
+	result["HypothesisDegree"] = static_cast<Json::UInt64>(hypothesisDegree);
+	result["HypothesisLiterals"] = static_cast<Json::UInt64>(hypothesisLiterals);
+	result["Hit"] = hit;
+	result["ProofResult"] = toString(proofResult);
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -64,6 +64,72 @@ Events Events::fromJSON(const Json::Value &json)
 			statistics.m_eventsHypothesisTested.emplace_back(std::make_tuple(time, event));
 		});
 
+	auto &eventsProofCacheAccessed = json["ProofCacheAccessed"];
+
+	std::for_each(eventsProofCacheAccessed.begin(), eventsProofCacheAccessed.end(),
+		[&](const auto &jsonEvent)
+		{
+			const auto event = EventProofCacheAccessed::fromJSON(jsonEvent);
+			const auto time = jsonEvent["Time"].asDouble();
+
+			statistics.m_eventsProofCacheAccessed.emplace_back(std::make_tuple(time, event));
+		});
+
+	auto &eventsHypothesisRefuted = json["HypothesisRefuted"];
+
+	std::for_each(eventsHypothesisRefuted.begin(), eventsHypothesisRefuted.end(),
+		[&](const auto &jsonEvent)
+		{
+			const auto event = EventHypothesisRefuted::fromJSON(jsonEvent);
+			const auto time = jsonEvent["Time"].asDouble();
+
+			statistics.m_eventsHypothesisRefuted.emplace_back(std::make_tuple(time, event));
+		});
+
+	auto &eventsFeedbackSimulated = json["FeedbackSimulated"];
+
+	std::for_each(eventsFeedbackSimulated.begin(), eventsFeedbackSimulated.end(),
+		[&](const auto &jsonEvent)
+		{
+			const auto event = EventFeedbackSimulated::fromJSON(jsonEvent);
+			const auto time = jsonEvent["Time"].asDouble();
+
+			statistics.m_eventsFeedbackSimulated.emplace_back(std::make_tuple(time, event));
+		});
+
+	auto &eventsExplicitStateChecked = json["ExplicitStateChecked"];
+
+	std::for_each(eventsExplicitStateChecked.begin(), eventsExplicitStateChecked.end(),
+		[&](const auto &jsonEvent)
+		{
+			const auto event = EventExplicitStateChecked::fromJSON(jsonEvent);
+			const auto time = jsonEvent["Time"].asDouble();
+
+			statistics.m_eventsExplicitStateChecked.emplace_back(std::make_tuple(time, event));
+		});
+
+	auto &eventsProgramReduced = json["ProgramReduced"];
+
+	std::for_each(eventsProgramReduced.begin(), eventsProgramReduced.end(),
+		[&](const auto &jsonEvent)
+		{
+			const auto event = EventProgramReduced::fromJSON(jsonEvent);
+			const auto time = jsonEvent["Time"].asDouble();
+
+			statistics.m_eventsProgramReduced.emplace_back(std::make_tuple(time, event));
+		});
+
+	auto &eventsFluentClosurePrecomputed = json["FluentClosurePrecomputed"];
+
+	std::for_each(eventsFluentClosurePrecomputed.begin(), eventsFluentClosurePrecomputed.end(),
+		[&](const auto &jsonEvent)
+		{
+			const auto event = EventFluentClosurePrecomputed::fromJSON(jsonEvent);
+			const auto time = jsonEvent["Time"].asDouble();
+
+			statistics.m_eventsFluentClosurePrecomputed.emplace_back(std::make_tuple(time, event));
+		});
+
 	auto &eventsConstraintLearned = json["ConstraintLearned"];
 
 	std::for_each(eventsConstraintLearned.begin(), eventsConstraintLearned.end(),
@@ -134,6 +200,72 @@ Json::Value Events::toJSON() const
 			json["HypothesisTested"].append(jsonEvent);
 		});
 
+	json["ProofCacheAccessed"] = Json::arrayValue;
+
+	std::for_each(m_eventsProofCacheAccessed.cbegin(), m_eventsProofCacheAccessed.cend(),
+		[&](const auto &event)
+		{
+			auto jsonEvent = std::get<1>(event).toJSON();
+			jsonEvent["Time"] = std::get<0>(event);
+
+			json["ProofCacheAccessed"].append(jsonEvent);
+		});
+
+	json["HypothesisRefuted"] = Json::arrayValue;
+
+	std::for_each(m_eventsHypothesisRefuted.cbegin(), m_eventsHypothesisRefuted.cend(),
+		[&](const auto &event)
+		{
+			auto jsonEvent = std::get<1>(event).toJSON();
+			jsonEvent["Time"] = std::get<0>(event);
+
+			json["HypothesisRefuted"].append(jsonEvent);
+		});
+
+	json["FeedbackSimulated"] = Json::arrayValue;
+
+	std::for_each(m_eventsFeedbackSimulated.cbegin(), m_eventsFeedbackSimulated.cend(),
+		[&](const auto &event)
+		{
+			auto jsonEvent = std::get<1>(event).toJSON();
+			jsonEvent["Time"] = std::get<0>(event);
+
+			json["FeedbackSimulated"].append(jsonEvent);
+		});
+
+	json["ExplicitStateChecked"] = Json::arrayValue;
+
+	std::for_each(m_eventsExplicitStateChecked.cbegin(), m_eventsExplicitStateChecked.cend(),
+		[&](const auto &event)
+		{
+			auto jsonEvent = std::get<1>(event).toJSON();
+			jsonEvent["Time"] = std::get<0>(event);
+
+			json["ExplicitStateChecked"].append(jsonEvent);
+		});
+
+	json["ProgramReduced"] = Json::arrayValue;
+
+	std::for_each(m_eventsProgramReduced.cbegin(), m_eventsProgramReduced.cend(),
+		[&](const auto &event)
+		{
+			auto jsonEvent = std::get<1>(event).toJSON();
+			jsonEvent["Time"] = std::get<0>(event);
+
+			json["ProgramReduced"].append(jsonEvent);
+		});
+
+	json["FluentClosurePrecomputed"] = Json::arrayValue;
+
+	std::for_each(m_eventsFluentClosurePrecomputed.cbegin(), m_eventsFluentClosurePrecomputed.cend(),
+		[&](const auto &event)
+		{
+			auto jsonEvent = std::get<1>(event).toJSON();
+			jsonEvent["Time"] = std::get<0>(event);
+
+			json["FluentClosurePrecomputed"].append(jsonEvent);
+		});
+
 	json["ConstaintLearned"] = Json::arrayValue;
 
 	std::for_each(m_eventsConstraintLearned.cbegin(), m_eventsConstraintLearned.cend(),
@@ -188,6 +320,48 @@ void Events::notifyHypothesisTested(const EventHypothesisTested &event)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Events::notifyProofCacheAccessed(const EventProofCacheAccessed &event)
+{
+	m_eventsProofCacheAccessed.emplace_back(std::make_tuple(time(), event));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Events::notifyHypothesisRefuted(const EventHypothesisRefuted &event)
+{
+	m_eventsHypothesisRefuted.emplace_back(std::make_tuple(time(), event));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Events::notifyFeedbackSimulated(const EventFeedbackSimulated &event)
+{
+	m_eventsFeedbackSimulated.emplace_back(std::make_tuple(time(), event));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Events::notifyExplicitStateChecked(const EventExplicitStateChecked &event)
+{
+	m_eventsExplicitStateChecked.emplace_back(std::make_tuple(time(), event));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Events::notifyProgramReduced(const EventProgramReduced &event)
+{
+	m_eventsProgramReduced.emplace_back(std::make_tuple(time(), event));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Events::notifyFluentClosurePrecomputed(const EventFluentClosurePrecomputed &event)
+{
+	m_eventsFluentClosurePrecomputed.emplace_back(std::make_tuple(time(), event));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Events::notifyConstraintLearned(const EventConstraintLearned &event)
 {
 	m_eventsConstraintLearned.emplace_back(std::make_tuple(time(), event));
@@ -230,6 +404,48 @@ const std::vector<Events::Timed<EventHypothesisTested>> &Events::eventsHypothesi
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const std::vector<Events::Timed<EventProofCacheAccessed>> &Events::eventsProofCacheAccessed() const
+{
+	return m_eventsProofCacheAccessed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Events::Timed<EventHypothesisRefuted>> &Events::eventsHypothesisRefuted() const
+{
+	return m_eventsHypothesisRefuted;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Events::Timed<EventFeedbackSimulated>> &Events::eventsFeedbackSimulated() const
+{
+	return m_eventsFeedbackSimulated;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Events::Timed<EventExplicitStateChecked>> &Events::eventsExplicitStateChecked() const
+{
+	return m_eventsExplicitStateChecked;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Events::Timed<EventProgramReduced>> &Events::eventsProgramReduced() const
+{
+	return m_eventsProgramReduced;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Events::Timed<EventFluentClosurePrecomputed>> &Events::eventsFluentClosurePrecomputed() const
+{
+	return m_eventsFluentClosurePrecomputed;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const std::vector<Events::Timed<EventConstraintLearned>> &Events::eventsConstraintLearned() const
 {
 	return m_eventsConstraintLearned;
@@ -0,0 +1,59 @@
+#include <ginkgo/feedback-loop/production/ExplicitStateChecking.h>
+
+#include <iostream>
+#include <boost/bimap.hpp>
+#include <boost/assign.hpp>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ExplicitStateChecking
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ExplicitStateCheckingNames = boost::bimap<ExplicitStateChecking, std::string>;
+static ExplicitStateCheckingNames explicitStateCheckingNames = boost::assign::list_of<ExplicitStateCheckingNames::relation>
+	(ExplicitStateChecking::NoExplicitStateChecking, "NoExplicitStateChecking")
+	(ExplicitStateChecking::UseExplicitStateChecking, "UseExplicitStateChecking")
+	(ExplicitStateChecking::CrossCheckExplicitStateChecking, "CrossCheckExplicitStateChecking");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::ostream &operator<<(std::ostream &ostream, const ExplicitStateChecking &explicitStateChecking)
+{
+	const auto match = explicitStateCheckingNames.left.find(explicitStateChecking);
+
+	if (match == explicitStateCheckingNames.left.end())
+		return (ostream << "Unknown");
+
+	return (ostream << (*match).second);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::istream &operator>>(std::istream &istream, ExplicitStateChecking &explicitStateChecking)
+{
+	std::string explicitStateCheckingName;
+	istream >> explicitStateCheckingName;
+
+	const auto match = explicitStateCheckingNames.right.find(explicitStateCheckingName);
+
+	if (match == explicitStateCheckingNames.right.end())
+		explicitStateChecking = ExplicitStateChecking::Unknown;
+	else
+		explicitStateChecking = (*match).second;
+
+	return istream;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -3,11 +3,17 @@
 #include <iostream>
 #include <limits>
 #include <thread>
+#include <future>
+#include <numeric>
+#include <iterator>
+#include <random>
 
 #include <json/json.h>
 
+#include <ginkgo/feedback-loop/production/RelevanceAnalysis.h>
+
+#include <ginkgo/solving/ClingoSolver.h>
 #include <ginkgo/utils/TextFile.h>
-#include <ginkgo/solving/ClaspOutputParsing.h>
 
 namespace ginkgo
 {
@@ -56,6 +62,18 @@ const std::string FeedbackLoop::FluentClosureEncoding =
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const std::string FeedbackLoop::PrecomputedFluentClosureEncoding =
+	// Choose from the fluent closure given as facts
+	"{holds(F, 0)} :- fluentClosure(F).\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string FeedbackLoop::InitialStateEncoding =
+	// Establish the initial state
+	"holds(F, 0) :- init(F).\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 const std::string FeedbackLoop::StateWiseProofEncoding =
 	// Degree of the hypothesis
 	"time(0..degree).\n"
@@ -67,9 +85,7 @@ const std::string FeedbackLoop::StateWiseProofEncoding =
 	// Apply effects
 	"holds(F, T) :- apply(A, T), adds(A, F), action(A), time(T).\n"
 	"del(F, T) :- apply(A, T), deletes(A, F), action(A), time(T).\n"
-	"holds(F, T) :- holds(F, T - 1), not del(F, T), time(T), time(T - 1).\n"
-	// Eliminate all states complying with the constraint
-	":- not hypothesisConstraint(0).\n";
+	"holds(F, T) :- holds(F, T - 1), not del(F, T), time(T), time(T - 1).\n";
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -86,9 +102,7 @@ const std::string FeedbackLoop::InductionProofBaseEncoding =
 	// Apply effects
 	"holds(F, T) :- apply(A, T), adds(A, F), action(A), time(T).\n"
 	"del(F, T) :- apply(A, T), deletes(A, F), action(A), time(T).\n"
-	"holds(F, T) :- holds(F, T - 1), not del(F, T), time(T), time(T - 1).\n"
-	// Eliminate all states complying with the constraint at t = 0
-	":- not hypothesisConstraint(0).\n";
+	"holds(F, T) :- holds(F, T - 1), not del(F, T), time(T), time(T - 1).\n";
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -103,7 +117,23 @@ const std::string FeedbackLoop::InductionProofStepEncoding =
 	// Apply effects
 	"holds(F, T) :- apply(A, T), adds(A, F), action(A), time(T).\n"
 	"del(F, T) :- apply(A, T), deletes(A, F), action(A), time(T).\n"
-	"holds(F, T) :- holds(F, T - 1), not del(F, T), time(T), time(T - 1).\n"
+	"holds(F, T) :- holds(F, T - 1), not del(F, T), time(T), time(T - 1).\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string FeedbackLoop::StateWiseProofCheckEncoding =
+	// Eliminate all states complying with the constraint
+	":- not hypothesisConstraint(0).\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string FeedbackLoop::InductionProofBaseCheckEncoding =
+	// Eliminate all states complying with the constraint at t = 0
+	":- not hypothesisConstraint(0).\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string FeedbackLoop::InductionProofStepCheckEncoding =
 	// Eliminate all states not complying with the constraint at t = 0
 	":- hypothesisConstraint(0).\n"
 	// Eliminate all states complying with the constraint at t = 1
@@ -111,14 +141,25 @@ const std::string FeedbackLoop::InductionProofStepEncoding =
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const std::string FeedbackLoop::CounterexampleEncoding =
+	"#show holds/2.\n"
+	"#show apply/2.\n"
+	"#show del/2.\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 FeedbackLoop::FeedbackLoop(std::unique_ptr<Environment> environment, std::unique_ptr<Configuration<Plain> > configuration)
 :	m_environment(std::move(environment)),
 	m_configuration(std::move(configuration)),
 	m_gringo(m_environment->gringoConfiguration()),
-	m_clasp(m_environment->claspConfiguration()),
 	m_xclasp(m_environment->xclaspConfiguration()),
+	m_stateWiseProofSession(ProofType::StateWiseProof),
+	m_inductionBaseProofSession(ProofType::InductionBaseProof),
+	m_inductionStepProofSession(ProofType::InductionStepProof),
 	m_feedback(m_environment->symbolTable()),
-	m_learnedConstraints(m_environment->symbolTable())
+	m_learnedConstraints(m_environment->symbolTable()),
+	m_counterexampleStore(m_environment->symbolTable()),
+	m_simulatedTraces(m_environment->symbolTable())
 {
 }
 
@@ -144,75 +185,74 @@ void FeedbackLoop::run()
 
 	mergeEncodings();
 
+	if (m_configuration->reduceProgram)
+		reduceProgram();
+
+	if (m_configuration->precomputeFluentClosure
+		&& m_configuration->fluentClosureUsage == FluentClosureUsage::UseFluentClosure)
+	{
+		precomputeFluentClosure();
+	}
+
+	if (m_configuration->simulatedWalks > 0
+		|| m_configuration->explicitStateChecking != ExplicitStateChecking::NoExplicitStateChecking)
+	{
+		readTransitionSystem();
+	}
+
+	if (m_simulator && m_configuration->simulatedWalks > 0)
+		simulateTraces();
+
+	if (m_configuration->explicitStateChecking != ExplicitStateChecking::NoExplicitStateChecking
+		&& m_configuration->proofMethod == ProofMethod::InductionProof)
+		std::cout << "[Warn ] Explicit-state checking only applies to state-wise proofs" << std::endl;
+
+	if (m_configuration->solverBackend == SolverBackend::ClingoIncremental)
+	{
+		startProofSessions();
+
+		if (m_configuration->testingPolicy == TestingPolicy::TestAll && m_configuration->proofWorkers > 1)
+			std::cout << "[Warn ] Proof workers do not share proof sessions and solve from scratch" << std::endl;
+
+		if (m_configuration->minimizationStrategy != MinimizationStrategy::NoMinimization
+			&& m_configuration->speculativeMinimizationCandidates > 1)
+			std::cout << "[Warn ] Speculative minimization is not supported with proof sessions" << std::endl;
+	}
+
+	if (m_configuration->minimizationStrategy == MinimizationStrategy::UnsatCoreMinimization
+		&& m_configuration->solverBackend == SolverBackend::Process)
+		std::cout << "[Warn ] Unsat-core minimization requires a clingo backend, using linear minimization instead" << std::endl;
+
 	m_events.startTimer();
 
 	bool startOver = true;
 
 	while (true)
 	{
-		generateFeedback(m_configuration->constraintsToExtract, startOver);
+		const auto extractedConstraints = generateFeedback(m_configuration->constraintsToExtract, startOver);
 
-		if (m_feedback.empty())
+		if (extractedConstraints == 0)
 			// No more constraints, exiting
 			break;
 
 		// If we couldn't prove anything, we'll extract more constraints next time
 		startOver = false;
 
-		auto extractedConstraints = m_feedback.size();
-
-		// Remove constraints with a too high degree
-		m_feedback.removeConstraintsWithTooHighDegree(m_configuration->maxDegree);
+		// Constraints exceeding the limits were rejected while parsing
+		const auto remainingConstraints = notifyRejectedFeedback(m_rejectedFeedback, extractedConstraints, m_events);
 
 		if (m_environment->logLevel() == LogLevel::Debug)
 		{
-			std::cout << "[Info ] \033[1;33mRemoved " << (extractedConstraints - m_feedback.size())
+			std::cout << "[Info ] \033[1;33mRemoved " << m_rejectedFeedback[Constraint::FilterResult::DegreeTooHigh]
 				<< " constraints with a degree higher than " << m_configuration->maxDegree
 				<< "\033[0m" << std::endl;
-		}
-
-		// Statistics
-		{
-			EventConstraintsRemoved event =
-			{
-				EventConstraintsRemoved::Source::Feedback,
-				EventConstraintsRemoved::Reason::DegreeTooHigh,
-				extractedConstraints - m_feedback.size(),
-				m_feedback.size()
-			};
-
-			m_events.notifyConstraintsRemoved(event);
-		}
-
-		extractedConstraints = m_feedback.size();
-
-		// Remove constraints with too many literals
-		m_feedback.removeConstraintsContainingTooManyLiterals(m_configuration->maxNumberOfLiterals);
-
-		if (m_environment->logLevel() == LogLevel::Debug)
-		{
-			std::cout << "[Info ] \033[1;33mRemoved " << (extractedConstraints - m_feedback.size())
+			std::cout << "[Info ] \033[1;33mRemoved " << m_rejectedFeedback[Constraint::FilterResult::ContainsTooManyLiterals]
 				<< " constraints containing more than " << m_configuration->maxNumberOfLiterals
 				<< " literals\033[0m" << std::endl;
 		}
 
-		// Statistics
-		{
-			EventConstraintsRemoved event =
-			{
-				EventConstraintsRemoved::Source::Feedback,
-				EventConstraintsRemoved::Reason::ContainsTooManyLiterals,
-				extractedConstraints - m_feedback.size(),
-				m_feedback.size()
-			};
-
-			m_events.notifyConstraintsRemoved(event);
-		}
-
-		extractedConstraints = m_feedback.size();
-
-		// Remove all 'terminal' literal
-		m_feedback.removeLiterals("terminal");
+		// Constraints containing only 'terminal' literals were rejected while parsing as well, and they
+		// are counted as subsumed as before
 
 		// Remove all constraints subsumed by previously proven constraints
 		std::for_each(m_learnedConstraints.cbegin(), m_learnedConstraints.cend(), [&](auto constraint)
@@ -226,13 +266,16 @@ void FeedbackLoop::run()
 			{
 				EventConstraintsRemoved::Source::Feedback,
 				EventConstraintsRemoved::Reason::Subsumed,
-				extractedConstraints - m_feedback.size(),
+				remainingConstraints - m_feedback.size(),
 				m_feedback.size()
 			};
 
 			m_events.notifyConstraintsRemoved(event);
 		}
 
+		if (m_simulatedTraces.size() > 0)
+			filterFeedbackBySimulation();
+
 		// Sort in descending order so that we can efficiently pop elements from the back
 		m_feedback.sortBy(Constraints::SortKey::TimeDegree, Constraints::SortDirection::Descending, true);
 
@@ -241,130 +284,48 @@ void FeedbackLoop::run()
 			BOOST_ASSERT(constraint);
 		});
 
-		while (!m_feedback.empty())
+		if (m_configuration->testingPolicy == TestingPolicy::TestAll && m_configuration->proofWorkers > 1)
+			startOver = testFeedbackConcurrently();
+		else
 		{
-			const auto constraint = m_feedback.back();
-			// Pop the constraint to test
-			m_feedback.pop_back();
-
-			BOOST_ASSERT(!constraint->containsIdentifier("terminal"));
-
-			auto hypothesis = GeneralizedConstraint(constraint);
-
-			if (m_environment->logLevel() == LogLevel::Debug)
-			{
-				std::cout << "[Info ] Testing hypothesis (degree: " << hypothesis.degree()
-					<< ", #literals: " << hypothesis.numberOfLiterals() << ")" << std::endl;
-			}
-
-			auto proofResult = ProofResult::Unknown;
-
-			switch (m_configuration->proofMethod)
-			{
-				case ProofMethod::StateWiseProof:
-					proofResult = testHypothesisStateWise(hypothesis, EventHypothesisTested::Purpose::Prove);
-					break;
-				case ProofMethod::InductionProof:
-					proofResult = testHypothesisInduction(hypothesis, EventHypothesisTested::Purpose::Prove);
-					break;
-				default:
-					std::cerr << "[Error] Unknown proof method" << std::endl;
-					break;
-			}
-
-			if (proofResult == ProofResult::Unknown)
+			while (!m_feedback.empty())
 			{
-				std::cerr << "[Error] Invalid proof result" << std::endl;
-				continue;
-			}
+				const auto constraint = m_feedback.back();
+				// Pop the constraint to test
+				m_feedback.pop_back();
 
-			if (proofResult == ProofResult::Unproven)
-			{
-				if (m_environment->logLevel() == LogLevel::Debug)
-					std::cout << "[Info ] \033[1;31mHypothesis unproven\033[0m" << std::endl;
+				BOOST_ASSERT(!constraint->containsIdentifier("terminal"));
 
-				continue;
-			}
+				auto hypothesis = GeneralizedConstraint(constraint);
 
-			if (proofResult == ProofResult::GroundingTimeout || proofResult == ProofResult::SolvingTimeout)
-			{
 				if (m_environment->logLevel() == LogLevel::Debug)
-					std::cout << "[Info ] \033[1;33mTimeout proving hypothesis\033[0m" << std::endl;
-
-				continue;
-			}
-
-			// TODO: Handle sigterm etc. and gracefully terminate all child processes
-
-			// Constraint is proven, now try to minimize it (if enabled)
-			if (m_configuration->minimizationStrategy == MinimizationStrategy::SimpleMinimization)
-				hypothesis = minimizeConstraint(hypothesis, 0);
-			else if (m_configuration->minimizationStrategy == MinimizationStrategy::LinearMinimization)
-				hypothesis = minimizeConstraint(hypothesis, 1);
-
-			// If proven, remove all subsumed constraints (they are weaker and also satisfied)
-			const auto feedbackSizeBefore = m_feedback.size();
-			m_feedback.removeConstraintsSubsumedBy(hypothesis);
-
-			if (m_environment->logLevel() == LogLevel::Debug)
-				std::cout << "[Info ] New constraint subsumed " << (feedbackSizeBefore - m_feedback.size()) << " constraints from feedback" << std::endl;
-
-			// Statistics
-			{
-				EventConstraintsRemoved event =
 				{
-					EventConstraintsRemoved::Source::Feedback,
-					EventConstraintsRemoved::Reason::Subsumed,
-					(feedbackSizeBefore - m_feedback.size()),
-					m_feedback.size()
-				};
+					std::cout << "[Info ] Testing hypothesis (degree: " << hypothesis.degree()
+						<< ", #literals: " << hypothesis.numberOfLiterals() << ")" << std::endl;
+				}
 
-				m_events.notifyConstraintsRemoved(event);
-			}
+				groundProofBatch(hypothesis);
 
-			std::for_each(m_feedback.cbegin(), m_feedback.cend(), [](auto constraint)
-			{
-				BOOST_ASSERT(constraint);
-			});
+				const auto proofResult = testHypothesis(hypothesis, EventHypothesisTested::Purpose::Prove);
 
-			// Add new generalized constraint
-			m_learnedConstraints.push_back(hypothesis.originalConstraint());
+				if (!checkProofResult(proofResult))
+					continue;
 
-			auto &directConstraintsStream = m_environment->directConstraintsStream();
-			auto &generalizedConstraintsStream = m_environment->generalizedConstraintsStream();
+				// TODO: Handle sigterm etc. and gracefully terminate all child processes
 
-			constraint->print(directConstraintsStream);
-			directConstraintsStream << std::endl;
+				learnConstraint(constraint, hypothesis);
 
-			hypothesis.print(generalizedConstraintsStream);
-			generalizedConstraintsStream << std::endl;
+				// We have learned a constraint, so we can extract new feedback next time
+				startOver = true;
 
-			// Statistics
-			{
-				EventConstraintLearned event =
-				{
-					hypothesis.degree(),
-					hypothesis.numberOfLiterals(),
-					m_learnedConstraints.size()
-				};
+				// Generate new feedback when using the find-first policy (else, continue testing with test-all)
+				if (m_configuration->testingPolicy == TestingPolicy::FindFirst)
+					break;
 
-				m_events.notifyConstraintLearned(event);
+				// Stop if we have proven enough constraints
+				if (m_learnedConstraints.size() >= m_configuration->constraintsToProve)
+					break;
 			}
-
-			std::cout << "[Info ] \033[1;32mHypothesis proven\033[0m" << " ("
-				<< m_learnedConstraints.size() << "/"
-				<< m_configuration->constraintsToProve << ")" << std::endl;
-
-			// We have learned a constraint, so we can extract new feedback next time
-			startOver = true;
-
-			// Generate new feedback when using the find-first policy (else, continue testing with test-all)
-			if (m_configuration->testingPolicy == TestingPolicy::FindFirst)
-				break;
-
-			// Stop if we have proven enough constraints
-			if (m_learnedConstraints.size() >= m_configuration->constraintsToProve)
-				break;
 		}
 
 		// Stop if we have proven enough constraints
@@ -399,42 +360,85 @@ void FeedbackLoop::run()
 
 void FeedbackLoop::mergeEncodings()
 {
-	if (!m_program.str().empty())
-	{
-		m_program.str(std::string());
-		m_program.clear();
-	}
+	std::stringstream program;
 
 	for (const auto &inputFileName : {m_configuration->instance, m_configuration->domain})
 	{
 		TextFile inputFile(inputFileName);
-		m_program << inputFile.read().rdbuf() << std::endl;
+		program << inputFile.read().rdbuf() << std::endl;
 	}
+
+	m_encodingBuilder.setProgram(program.str());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void FeedbackLoop::generateFeedback(size_t constraintsToExtract, bool startOver)
+void FeedbackLoop::startProofSessions()
 {
-	if (startOver)
+	const auto &program = *m_encodingBuilder.program();
+
+	switch (m_configuration->proofMethod)
+	{
+		case ProofMethod::StateWiseProof:
+			m_stateWiseProofSession.groundProgram(program + stateGeneratorEncoding() + CounterexampleEncoding);
+			break;
+		case ProofMethod::InductionProof:
+			m_inductionBaseProofSession.groundProgram(program + InitialStateEncoding + CounterexampleEncoding);
+			m_inductionStepProofSession.groundProgram(program + stateGeneratorEncoding() + CounterexampleEncoding);
+			break;
+		// Interrupting the losing proof would abort all future proofs of its session
+		case ProofMethod::Portfolio:
+			std::cerr << "[Error] Proof sessions do not support portfolios" << std::endl;
+			break;
+		default:
+			std::cerr << "[Error] Unknown proof method" << std::endl;
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t FeedbackLoop::notifyRejectedFeedback(const std::map<Constraint::FilterResult, size_t> &rejectedFeedback,
+	size_t extractedConstraints, Events &events)
+{
+	auto remainingConstraints = extractedConstraints;
+
+	const auto notify = [&](Constraint::FilterResult filterResult, EventConstraintsRemoved::Reason reason)
 	{
-		m_program.clear();
-		m_program.seekg(0, std::ios::beg);
+		const auto match = rejectedFeedback.find(filterResult);
+		const auto removedConstraints = (match == rejectedFeedback.cend() ? 0 : match->second);
 
-		std::stringstream metaEncoding;
-		metaEncoding
-			<< "#const horizon=" << m_configuration->horizon << "." << std::endl
-			<< MetaEncoding << std::endl
-			<< m_program.rdbuf() << std::endl;
+		remainingConstraints -= removedConstraints;
 
-		std::for_each(m_learnedConstraints.cbegin(), m_learnedConstraints.cend(), [&](const auto &constraint)
+		const EventConstraintsRemoved event =
 		{
-			GeneralizedConstraint(constraint).print(metaEncoding);
-			metaEncoding << std::endl;
-		});
+			EventConstraintsRemoved::Source::Feedback,
+			reason,
+			removedConstraints,
+			remainingConstraints
+		};
+
+		events.notifyConstraintsRemoved(event);
+	};
+
+	notify(Constraint::FilterResult::DegreeTooHigh, EventConstraintsRemoved::Reason::DegreeTooHigh);
+	notify(Constraint::FilterResult::ContainsTooManyLiterals, EventConstraintsRemoved::Reason::ContainsTooManyLiterals);
+
+	return remainingConstraints;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t FeedbackLoop::generateFeedback(size_t constraintsToExtract, bool startOver)
+{
+	m_rejectedFeedback.clear();
 
-		metaEncoding.clear();
-		metaEncoding.seekg(0, std::ios::beg);
+	if (startOver)
+	{
+		Encoding metaEncoding;
+		metaEncoding.append("#const horizon=" + std::to_string(m_configuration->horizon) + ".\n" + MetaEncoding + "\n");
+		metaEncoding.append(m_encodingBuilder.program());
+		metaEncoding.append(m_encodingBuilder.learnedConstraints());
 
 		bool extractionTimeout = false;
 
@@ -459,7 +463,7 @@ void FeedbackLoop::generateFeedback(size_t constraintsToExtract, bool startOver)
 			const EventFinished event = {EventFinished::Reason::ExtractionTimeout};
 			m_events.notifyFinished(event);
 			std::cerr << "[Info ] Knowledge extraction timeout, exiting" << std::endl;
-			return;
+			return 0;
 		}
 	}
 
@@ -480,7 +484,7 @@ void FeedbackLoop::generateFeedback(size_t constraintsToExtract, bool startOver)
 			const EventFinished event = {EventFinished::Reason::FeedbackEmpty};
 			m_events.notifyFinished(event);
 			std::cerr << "[Info ] No more constraints available (solver terminated) ..." << std::endl;
-			return;
+			return m_feedback.size();
 		}
 
 		m_xclasp.resume();
@@ -491,47 +495,55 @@ void FeedbackLoop::generateFeedback(size_t constraintsToExtract, bool startOver)
 
 	const auto startTime = std::chrono::high_resolution_clock::now();
 
+	auto &constraintLines = m_xclasp.stderrLines();
+	boost::string_ref constraintLine;
+
+	// Constraints exceeding the limits are rejected before they are parsed completely
+	const ConstraintFilter filter = {m_configuration->maxDegree, m_configuration->maxNumberOfLiterals, "terminal"};
+
+	auto extractedConstraints = m_feedback.size();
+
 	// Extract requested number of constraints
-	while (true)
+	while (extractedConstraints < constraintsToExtract)
 	{
-		if (!m_xclasp.waitForEvent())
+		if (!constraintLines.pop(constraintLine))
 		{
-			// Clasp terminated; join thread
-			m_xclasp.join();
-			break;
-		}
+			if (m_xclasp.waitForEvent())
+				continue;
 
-		std::lock_guard<std::mutex> lock(m_xclasp.stderrAccessMutex());
+			// Clasp terminated after publishing its last lines; join thread
+			if (!constraintLines.pop(constraintLine))
+			{
+				m_xclasp.join();
+				break;
+			}
+		}
 
-		auto *stderr = m_xclasp.stderr();
-		if (!stderr)
+		if (constraintLine.empty())
 			continue;
 
-		const auto constraintString = stderr->str();
-		m_xclasp.clearStderr();
+		Constraint::FilterResult filterResult;
+		auto constraint = Constraint::parse(extractedConstraints, constraintLine, m_environment->symbolTable(), filter, filterResult);
 
-		if (constraintString.size() < 2)
-			continue;
+		extractedConstraints++;
 
-		// TODO: Don't copy stderr
-		auto constraint = std::make_shared<Constraint>(m_feedback.size(), constraintString, m_environment->symbolTable());
-		m_feedback.push_back(std::move(constraint));
+		if (constraint)
+			m_feedback.push_back(std::move(constraint));
+		else
+			m_rejectedFeedback[filterResult]++;
 
 		if (m_environment->logLevel() == LogLevel::Debug)
 		{
-			if (m_feedback.size() % 256 == 0)
-				std::cout << "[Debug] " << m_feedback.size() << " constraints" << std::endl;
+			if (extractedConstraints % 256 == 0)
+				std::cout << "[Debug] " << extractedConstraints << " constraints" << std::endl;
 		}
-
-		if (m_feedback.size() >= constraintsToExtract)
-			break;
 	}
 
 	if (m_xclasp.exists())
 		m_xclasp.pause();
 
 	if (m_environment->logLevel() == LogLevel::Debug)
-		std::cout << "[Info ] Extracted " << m_feedback.size() << " constraints" << std::endl;
+		std::cout << "[Info ] Extracted " << extractedConstraints << " constraints" << std::endl;
 
 	const auto now = std::chrono::high_resolution_clock::now();
 
@@ -540,105 +552,283 @@ void FeedbackLoop::generateFeedback(size_t constraintsToExtract, bool startOver)
 		startOver ? EventFeedbackExtracted::Mode::StartOver : EventFeedbackExtracted::Mode::Resume,
 		std::chrono::duration<double>(now - startTime).count(),
 		constraintsToExtract,
-		m_feedback.size()
+		extractedConstraints
 	};
 
 	m_events.notifyFeedbackExtracted(event);
 
-	if (m_feedback.empty())
+	if (extractedConstraints == 0)
 	{
 		// Statistics
 		const EventFinished event = {EventFinished::Reason::FeedbackEmpty};
 		m_events.notifyFinished(event);
 		std::cerr << "[Info ] No more constraints available (solver didn't find anything) ..." << std::endl;
-		return;
 	}
+
+	return extractedConstraints;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-GeneralizedConstraint FeedbackLoop::minimizeConstraint(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement)
+bool FeedbackLoop::testFeedbackConcurrently()
 {
-	const auto literalsBefore = provenGeneralizedConstraint.numberOfLiterals();
-	const auto degreeBefore = provenGeneralizedConstraint.degree();
-	size_t requiredTests = 0;
+	bool learnedConstraint = false;
 
-	// If nothing works, keep the original constraint
-	GeneralizedConstraint result = provenGeneralizedConstraint;
+	const auto launchProofJobs = [&]()
+	{
+		while (m_proofJobs.size() < m_configuration->proofWorkers && !m_feedback.empty())
+		{
+			const auto constraint = m_feedback.back();
+			// Pop the constraint to test
+			m_feedback.pop_back();
 
-	if (m_environment->logLevel() == LogLevel::Debug)
-		std::cout << "[Info ] Trying to minimize " << provenGeneralizedConstraint << std::endl;
+			BOOST_ASSERT(!constraint->containsIdentifier("terminal"));
 
-	// Start with windows of size 1
-	size_t windowSize = 1;
+			const GeneralizedConstraint hypothesis(constraint);
+			auto knownProofResult = ProofResult::Unknown;
 
-	for (size_t i = 0; i < result.numberOfLiterals();)
-	{
-		if (m_environment->logLevel() == LogLevel::Debug)
-			std::cout << "[Info ] Trying to eliminate " << windowSize << " literals starting at " << i << std::endl;
+			// Known results are passed on without running any proofs
+			if (findCachedProofResult(hypothesis, EventHypothesisTested::Purpose::Prove, knownProofResult)
+				|| refuteWithCounterexamples(hypothesis, EventHypothesisTested::Purpose::Prove, knownProofResult)
+				|| (m_configuration->explicitStateChecking == ExplicitStateChecking::UseExplicitStateChecking
+					&& checkExplicitStates(hypothesis, EventHypothesisTested::Purpose::Prove, knownProofResult)))
+			{
+				auto hypothesisTest = std::make_unique<HypothesisTest>(*m_environment, m_configuration->solverBackend,
+					m_configuration->pipelineProcesses, m_configuration->keepCounterexamples, m_configuration->hypothesisTestingTimeout, hypothesis, EventHypothesisTested::Purpose::Prove);
 
-		GeneralizedConstraint hypothesis(result.originalConstraint()->withoutLiterals(i, windowSize));
+				std::promise<ProofResult> proofResult;
+				proofResult.set_value(knownProofResult);
 
-		// Skip candidates that have become empty due to removing literals
-		if (hypothesis.numberOfLiterals() == 0)
-		{
-			if (m_environment->logLevel() == LogLevel::Debug)
-				std::cout << "[Info ] Skipped empty candidate property" << std::endl;
+				m_proofJobs.push_back({constraint, std::move(hypothesisTest), m_learnedConstraints.size(), proofResult.get_future()});
+				continue;
+			}
 
-			i++;
-			continue;
-		}
+			auto hypothesisTest = makeHypothesisTest(hypothesis, EventHypothesisTested::Purpose::Prove);
+			auto &hypothesisTestReference = *hypothesisTest;
 
-		ProofResult proofResult = ProofResult::Unknown;
+			auto proofResult = std::async(std::launch::async, [&hypothesisTestReference]()
+			{
+				return hypothesisTestReference.run();
+			});
 
-		switch (m_configuration->proofMethod)
-		{
-			case ProofMethod::StateWiseProof:
-				proofResult = testHypothesisStateWise(hypothesis, EventHypothesisTested::Purpose::Minimize);
-				break;
-			case ProofMethod::InductionProof:
-				proofResult = testHypothesisInduction(hypothesis, EventHypothesisTested::Purpose::Minimize);
-				break;
-			default:
-				std::cerr << "[Error] Unknown proof method" << std::endl;
-				break;
+			m_proofJobs.push_back({constraint, std::move(hypothesisTest), m_learnedConstraints.size(), std::move(proofResult)});
 		}
+	};
 
-		requiredTests++;
+	launchProofJobs();
 
-		if (proofResult == ProofResult::Unknown)
+	// Results are applied in the order the constraints were popped, just like with a single worker
+	while (!m_proofJobs.empty())
+	{
+		auto proofJob = std::move(m_proofJobs.front());
+		m_proofJobs.pop_front();
+
+		auto proofResult = proofJob.proofResult.get();
+		auto hypothesis = proofJob.hypothesisTest->hypothesis();
+
+		storeCounterexamples(proofJob.hypothesisTest->counterexamples());
+
+		if (m_environment->logLevel() == LogLevel::Debug)
 		{
-			std::cerr << "[Error] Invalid proof result" << std::endl;
-			continue;
+			std::cout << "[Info ] Tested hypothesis (degree: " << hypothesis.degree()
+				<< ", #literals: " << hypothesis.numberOfLiterals() << ")" << std::endl;
 		}
 
-		if (proofResult == ProofResult::Unproven
-			|| proofResult == ProofResult::GroundingTimeout
-			|| proofResult == ProofResult::SolvingTimeout)
+		// Constraints learned in the meantime only make proofs easier, so only unsuccessful tests
+		// need to be repeated with the current learned constraints
+		if (proofJob.learnedConstraints != m_learnedConstraints.size() && proofResult != ProofResult::Proven)
+			proofResult = testHypothesis(hypothesis, EventHypothesisTested::Purpose::Prove);
+		else
 		{
-			// Try again with smallest window size
-			if (windowSize > 1)
-			{
-				windowSize = 1;
-				continue;
-			}
+			// Statistics
+			std::for_each(proofJob.hypothesisTest->events().cbegin(), proofJob.hypothesisTest->events().cend(),
+				[&](const auto &event)
+				{
+					m_events.notifyHypothesisTested(event);
+				});
 
-			i++;
-			continue;
+			cacheProofResult(hypothesis, proofJob.learnedConstraints, proofResult);
 		}
 
-		// If proven, then just keep the minimized candidate and try to minimize further
-		result = hypothesis;
+		if (checkProofResult(proofResult))
+		{
+			learnConstraint(proofJob.constraint, hypothesis);
+			learnedConstraint = true;
 
-		// Also increase the window size by 1
-		windowSize += linearIncrement;
+			// Stop if we have proven enough constraints
+			if (m_learnedConstraints.size() >= m_configuration->constraintsToProve)
+				break;
+		}
+
+		launchProofJobs();
 	}
 
-	if (m_environment->logLevel() == LogLevel::Debug)
+	// Abort the tests that are not needed anymore
+	std::for_each(m_proofJobs.begin(), m_proofJobs.end(), [](auto &proofJob)
 	{
-		std::cout << "[Info ] \033[1;34mEliminated "
-			<< (provenGeneralizedConstraint.numberOfLiterals() - result.numberOfLiterals())
-			<< "/" << provenGeneralizedConstraint.numberOfLiterals()
+		proofJob.hypothesisTest->cancel();
+	});
+
+	std::for_each(m_proofJobs.begin(), m_proofJobs.end(), [](auto &proofJob)
+	{
+		proofJob.proofResult.wait();
+	});
+
+	m_proofJobs.clear();
+
+	return learnedConstraint;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FeedbackLoop::checkProofResult(ProofResult proofResult) const
+{
+	if (proofResult == ProofResult::Unknown)
+	{
+		std::cerr << "[Error] Invalid proof result" << std::endl;
+		return false;
+	}
+
+	if (proofResult == ProofResult::Unproven)
+	{
+		if (m_environment->logLevel() == LogLevel::Debug)
+			std::cout << "[Info ] \033[1;31mHypothesis unproven\033[0m" << std::endl;
+
+		return false;
+	}
+
+	if (proofResult == ProofResult::GroundingTimeout || proofResult == ProofResult::SolvingTimeout)
+	{
+		if (m_environment->logLevel() == LogLevel::Debug)
+			std::cout << "[Info ] \033[1;33mTimeout proving hypothesis\033[0m" << std::endl;
+
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::learnConstraint(const ConstraintPtr &constraint, GeneralizedConstraint hypothesis)
+{
+	// Constraint is proven, now try to minimize it (if enabled)
+	if (m_configuration->minimizationStrategy == MinimizationStrategy::SimpleMinimization)
+		hypothesis = minimizeConstraint(hypothesis, 0);
+	else if (m_configuration->minimizationStrategy == MinimizationStrategy::LinearMinimization)
+		hypothesis = minimizeConstraint(hypothesis, 1);
+	else if (m_configuration->minimizationStrategy == MinimizationStrategy::QuickXplainMinimization)
+		hypothesis = minimizeConstraint(hypothesis, 0);
+	else if (m_configuration->minimizationStrategy == MinimizationStrategy::UnsatCoreMinimization)
+		hypothesis = minimizeConstraint(hypothesis, 1);
+
+	// If proven, remove all subsumed constraints (they are weaker and also satisfied)
+	const auto feedbackSizeBefore = m_feedback.size() + m_proofJobs.size();
+	m_feedback.removeConstraintsSubsumedBy(hypothesis);
+
+	// Constraints that are currently being tested count as part of the feedback
+	m_proofJobs.erase(std::remove_if(m_proofJobs.begin(), m_proofJobs.end(), [&](auto &proofJob)
+	{
+		if (!hypothesis.subsumes(*proofJob.constraint))
+			return false;
+
+		proofJob.hypothesisTest->cancel();
+		proofJob.proofResult.wait();
+
+		return true;
+	}), m_proofJobs.end());
+
+	const auto feedbackSizeAfter = m_feedback.size() + m_proofJobs.size();
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] New constraint subsumed " << (feedbackSizeBefore - feedbackSizeAfter) << " constraints from feedback" << std::endl;
+
+	// Statistics
+	{
+		EventConstraintsRemoved event =
+		{
+			EventConstraintsRemoved::Source::Feedback,
+			EventConstraintsRemoved::Reason::Subsumed,
+			(feedbackSizeBefore - feedbackSizeAfter),
+			feedbackSizeAfter
+		};
+
+		m_events.notifyConstraintsRemoved(event);
+	}
+
+	std::for_each(m_feedback.cbegin(), m_feedback.cend(), [](auto constraint)
+	{
+		BOOST_ASSERT(constraint);
+	});
+
+	// Add new generalized constraint
+	m_learnedConstraints.push_back(hypothesis.originalConstraint());
+	m_encodingBuilder.addLearnedConstraint(hypothesis.originalConstraint());
+	m_counterexampleStore.addLearnedConstraint(*hypothesis.originalConstraint());
+	m_simulatedTraces.addLearnedConstraint(*hypothesis.originalConstraint());
+
+	auto &directConstraintsStream = m_environment->directConstraintsStream();
+	auto &generalizedConstraintsStream = m_environment->generalizedConstraintsStream();
+
+	constraint->print(directConstraintsStream);
+	directConstraintsStream << std::endl;
+
+	hypothesis.print(generalizedConstraintsStream);
+	generalizedConstraintsStream << std::endl;
+
+	// Statistics
+	{
+		EventConstraintLearned event =
+		{
+			hypothesis.degree(),
+			hypothesis.numberOfLiterals(),
+			m_learnedConstraints.size()
+		};
+
+		m_events.notifyConstraintLearned(event);
+	}
+
+	std::cout << "[Info ] \033[1;32mHypothesis proven\033[0m" << " ("
+		<< m_learnedConstraints.size() << "/"
+		<< m_configuration->constraintsToProve << ")" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GeneralizedConstraint FeedbackLoop::minimizeConstraint(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement)
+{
+	const auto literalsBefore = provenGeneralizedConstraint.numberOfLiterals();
+	const auto degreeBefore = provenGeneralizedConstraint.degree();
+	size_t requiredTests = 0;
+	size_t speculativeTests = 0;
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Trying to minimize " << provenGeneralizedConstraint << std::endl;
+
+	// Proof sessions cannot be used concurrently
+	const auto minimizeSpeculatively = m_configuration->speculativeMinimizationCandidates > 1
+		&& m_configuration->solverBackend != SolverBackend::ClingoIncremental;
+
+	auto result = provenGeneralizedConstraint;
+
+	if (m_configuration->minimizationStrategy == MinimizationStrategy::QuickXplainMinimization)
+		result = minimizeConstraintQuickXplain(provenGeneralizedConstraint, requiredTests);
+	// Unsatisfiable cores are not available from clasp processes
+	else if (m_configuration->minimizationStrategy == MinimizationStrategy::UnsatCoreMinimization
+		&& m_configuration->solverBackend != SolverBackend::Process)
+	{
+		result = minimizeConstraintWithUnsatCores(provenGeneralizedConstraint, requiredTests);
+	}
+	else if (minimizeSpeculatively)
+		result = minimizeConstraintSpeculatively(provenGeneralizedConstraint, linearIncrement, requiredTests, speculativeTests);
+	else
+		result = minimizeConstraintSequentially(provenGeneralizedConstraint, linearIncrement, requiredTests);
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+	{
+		std::cout << "[Info ] \033[1;34mEliminated "
+			<< (provenGeneralizedConstraint.numberOfLiterals() - result.numberOfLiterals())
+			<< "/" << provenGeneralizedConstraint.numberOfLiterals()
 			<< " literals through minimization\033[0m" << std::endl;
 	}
 
@@ -653,7 +843,8 @@ GeneralizedConstraint FeedbackLoop::minimizeConstraint(const GeneralizedConstrai
 			result.numberOfLiterals(),
 			degreeBefore - degreeAfter,
 			degreeAfter,
-			requiredTests
+			requiredTests,
+			speculativeTests
 		};
 
 		m_events.notifyMinimized(event);
@@ -664,267 +855,1193 @@ GeneralizedConstraint FeedbackLoop::minimizeConstraint(const GeneralizedConstrai
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-ProofResult FeedbackLoop::testHypothesisStateWise(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose)
+GeneralizedConstraint FeedbackLoop::minimizeConstraintSequentially(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement, size_t &requiredTests)
 {
-	m_program.clear();
-	m_program.seekg(0, std::ios::beg);
-
-	std::stringstream proofEncoding;
-	proofEncoding
-		<< m_program.rdbuf();
-
-	if (m_configuration->fluentClosureUsage == FluentClosureUsage::UseFluentClosure)
-		proofEncoding << FluentClosureEncoding;
-	else
-		proofEncoding << StateGeneratorEncoding;
+	// If nothing works, keep the original constraint
+	GeneralizedConstraint result = provenGeneralizedConstraint;
 
-	proofEncoding
-		<< "#const degree=" << generalizedHypothesis.degree() << "." << std::endl
-		<< "hypothesisConstraint(T) " << generalizedHypothesis << std::endl
-		<< StateWiseProofEncoding << std::endl;
+	// Start with windows of size 1
+	size_t windowSize = 1;
 
-	std::for_each(m_learnedConstraints.cbegin(), m_learnedConstraints.cend(), [&](const auto &constraint)
+	for (size_t i = 0; i < result.numberOfLiterals();)
 	{
-		GeneralizedConstraint(constraint).print(proofEncoding);
-		proofEncoding << std::endl;
-	});
-
-	proofEncoding.clear();
-	proofEncoding.seekg(0, std::ios::beg);
-
-	bool groundingTimeout = false;
-	bool solvingTimeout = false;
+		if (m_environment->logLevel() == LogLevel::Debug)
+			std::cout << "[Info ] Trying to eliminate " << windowSize << " literals starting at " << i << std::endl;
 
-	const auto groundingStartTime = std::chrono::high_resolution_clock::now();
-	m_gringo.run(proofEncoding, m_configuration->hypothesisTestingTimeout, groundingTimeout);
-	m_gringo.join();
-	const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+		GeneralizedConstraint hypothesis(result.originalConstraint()->withoutLiterals(i, windowSize));
 
-	auto satisfiable = Satisfiability::Unknown;
+		// Skip candidates that have become empty due to removing literals
+		if (hypothesis.numberOfLiterals() == 0)
+		{
+			if (m_environment->logLevel() == LogLevel::Debug)
+				std::cout << "[Info ] Skipped empty candidate property" << std::endl;
 
-	if (!groundingTimeout)
-	{
-		BOOST_ASSERT(m_gringo.stdout());
+			i++;
+			continue;
+		}
 
-		if (m_gringo.stderr() && parseForWarnings(*m_gringo.stderr()))
-			std::cout << "[Warn ] Warning while grounding: " << m_gringo.stderr()->rdbuf() << std::endl;
+		const auto proofResult = testHypothesis(hypothesis, EventHypothesisTested::Purpose::Minimize);
 
-		m_clasp.run(*m_gringo.stdout(), m_configuration->hypothesisTestingTimeout, solvingTimeout);
-		m_clasp.join();
+		requiredTests++;
 
-		BOOST_ASSERT(m_clasp.stdout());
-		satisfiable = parseForSatisfiability(*m_clasp.stdout());
-	}
+		if (proofResult == ProofResult::Unknown)
+		{
+			std::cerr << "[Error] Invalid proof result" << std::endl;
+			continue;
+		}
 
-	auto proofResult = ProofResult::Unknown;
+		if (proofResult == ProofResult::Unproven
+			|| proofResult == ProofResult::GroundingTimeout
+			|| proofResult == ProofResult::SolvingTimeout)
+		{
+			// Try again with smallest window size
+			if (windowSize > 1)
+			{
+				windowSize = 1;
+				continue;
+			}
 
-	if (groundingTimeout)
-		proofResult = ProofResult::GroundingTimeout;
-	else if (solvingTimeout)
-		proofResult = ProofResult::SolvingTimeout;
-	else if (satisfiable == Satisfiability::Unsatisfiable)
-		proofResult = ProofResult::Proven;
-	else if (satisfiable == Satisfiability::Satisfiable)
-		proofResult = ProofResult::Unproven;
-	else
-		std::cout << "[Warn ] Proof result is unknown" << std::endl;
+			i++;
+			continue;
+		}
 
-	// Statistics
-	{
-		EventHypothesisTested event =
-		{
-			ProofType::StateWiseProof,
-			purpose,
-			generalizedHypothesis.degree(),
-			generalizedHypothesis.numberOfLiterals(),
-			proofResult,
-			std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count()
-		};
-		*m_clasp.stdout() >> event.claspJSONOutput;
+		// If proven, then just keep the minimized candidate and try to minimize further
+		result = hypothesis;
 
-		m_events.notifyHypothesisTested(event);
+		// Also increase the window size by 1
+		windowSize += linearIncrement;
 	}
 
-	return proofResult;
+	return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-ProofResult FeedbackLoop::testHypothesisInduction(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose)
+GeneralizedConstraint FeedbackLoop::minimizeConstraintSpeculatively(const GeneralizedConstraint &provenGeneralizedConstraint, size_t linearIncrement, size_t &requiredTests, size_t &speculativeTests)
 {
-	m_program.clear();
-	m_program.seekg(0, std::ios::beg);
+	// If nothing works, keep the original constraint
+	GeneralizedConstraint result = provenGeneralizedConstraint;
+
+	// Start with windows of size 1
+	size_t windowSize = 1;
 
-	////////////////////////////////////////////////////////////////////////////////////////////////
-	// Induction Base
-	////////////////////////////////////////////////////////////////////////////////////////////////
+	for (size_t i = 0; i < result.numberOfLiterals();)
 	{
-		std::stringstream inductionBaseEncoding;
-		inductionBaseEncoding
-			<< m_program.rdbuf()
-			<< "#const degree=" << generalizedHypothesis.degree() << "." << std::endl
-			<< "hypothesisConstraint(T) ";
+		// Test the next consecutive windows concurrently, all against the current constraint
+		std::vector<size_t> windowStarts;
+
+		for (auto windowStart = i; windowStart < result.numberOfLiterals()
+			&& windowStarts.size() < m_configuration->speculativeMinimizationCandidates; windowStart += windowSize)
+		{
+			windowStarts.push_back(windowStart);
+		}
 
-		generalizedHypothesis.print(inductionBaseEncoding);
+		if (m_environment->logLevel() == LogLevel::Debug)
+			std::cout << "[Info ] Trying to eliminate " << windowStarts.size() << " windows of "
+				<< windowSize << " literals starting at " << i << std::endl;
 
-		inductionBaseEncoding
-			<< std::endl
-			<< InductionProofBaseEncoding << std::endl;
+		std::vector<std::unique_ptr<HypothesisTest>> hypothesisTests;
+		std::vector<std::future<ProofResult>> proofResults;
 
-		std::for_each(m_learnedConstraints.cbegin(), m_learnedConstraints.cend(), [&](const auto &constraint)
+		std::for_each(windowStarts.cbegin(), windowStarts.cend(), [&](const auto windowStart)
 		{
-			GeneralizedConstraint(constraint).print(inductionBaseEncoding);
-			inductionBaseEncoding << std::endl;
-		});
+			GeneralizedConstraint hypothesis(result.originalConstraint()->withoutLiterals(windowStart, windowSize));
+
+			// Skip candidates that have become empty due to removing literals
+			if (hypothesis.numberOfLiterals() == 0)
+			{
+				hypothesisTests.push_back(nullptr);
+				proofResults.emplace_back();
+				return;
+			}
 
-		inductionBaseEncoding.clear();
-		inductionBaseEncoding.seekg(0, std::ios::beg);
+			auto knownProofResult = ProofResult::Unknown;
 
-		bool groundingTimeout = false;
-		bool solvingTimeout = false;
+			// Known results are passed on without running any proofs
+			if (findCachedProofResult(hypothesis, EventHypothesisTested::Purpose::Minimize, knownProofResult)
+				|| refuteWithCounterexamples(hypothesis, EventHypothesisTested::Purpose::Minimize, knownProofResult)
+				|| (m_configuration->explicitStateChecking == ExplicitStateChecking::UseExplicitStateChecking
+					&& checkExplicitStates(hypothesis, EventHypothesisTested::Purpose::Minimize, knownProofResult)))
+			{
+				hypothesisTests.push_back(std::make_unique<HypothesisTest>(*m_environment, m_configuration->solverBackend,
+					m_configuration->pipelineProcesses, m_configuration->keepCounterexamples, m_configuration->hypothesisTestingTimeout, hypothesis, EventHypothesisTested::Purpose::Minimize));
 
-		const auto groundingStartTime = std::chrono::high_resolution_clock::now();
-		m_gringo.run(inductionBaseEncoding, m_configuration->hypothesisTestingTimeout, groundingTimeout);
-		m_gringo.join();
-		const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+				std::promise<ProofResult> proofResult;
+				proofResult.set_value(knownProofResult);
+				proofResults.push_back(proofResult.get_future());
+				return;
+			}
+
+			auto hypothesisTest = makeHypothesisTest(hypothesis, EventHypothesisTested::Purpose::Minimize);
+			auto &hypothesisTestReference = *hypothesisTest;
+
+			proofResults.push_back(std::async(std::launch::async, [&hypothesisTestReference]()
+			{
+				return hypothesisTestReference.run();
+			}));
 
-		auto satisfiable = Satisfiability::Unknown;
+			hypothesisTests.push_back(std::move(hypothesisTest));
+		});
+
+		// Windows that can be removed, in the order the sequential minimization would find them
+		std::vector<size_t> provenWindows;
+		// Window at which the sequential minimization would continue differently than speculated
+		auto stopWindow = windowStarts.size();
 
-		if (!groundingTimeout)
+		for (size_t j = 0; j < windowStarts.size(); j++)
 		{
-			BOOST_ASSERT(m_gringo.stdout());
+			if (!hypothesisTests[j])
+				continue;
+
+			const auto proofResult = proofResults[j].get();
+
+			storeCounterexamples(hypothesisTests[j]->counterexamples());
+
+			// Statistics
+			std::for_each(hypothesisTests[j]->events().cbegin(), hypothesisTests[j]->events().cend(),
+				[&](const auto &event)
+				{
+					m_events.notifyHypothesisTested(event);
+				});
+
+			cacheProofResult(hypothesisTests[j]->hypothesis(), m_learnedConstraints.size(), proofResult);
+
+			if (stopWindow < windowStarts.size())
+			{
+				speculativeTests++;
+				continue;
+			}
+
+			requiredTests++;
 
-			if (m_gringo.stderr() && parseForWarnings(*m_gringo.stderr()))
-				std::cout << "[Warn ] Warning while grounding: " << m_gringo.stderr()->rdbuf() << std::endl;
+			if (proofResult == ProofResult::Unknown)
+				std::cerr << "[Error] Invalid proof result" << std::endl;
 
-			m_clasp.run(*m_gringo.stdout(), m_configuration->hypothesisTestingTimeout, solvingTimeout);
-			m_clasp.join();
+			if (proofResult == ProofResult::Proven)
+			{
+				provenWindows.push_back(j);
+				continue;
+			}
 
-			BOOST_ASSERT(m_clasp.stdout());
-			satisfiable = parseForSatisfiability(*m_clasp.stdout());
+			// Try again with smallest window size
+			if (windowSize > 1)
+				stopWindow = j;
 		}
 
-		auto proofResult = ProofResult::Unknown;
+		const auto removeWindows = [&](auto begin, auto end)
+		{
+			auto constraint = result.originalConstraint();
 
-		if (groundingTimeout)
-			proofResult = ProofResult::GroundingTimeout;
-		else if (solvingTimeout)
-			proofResult = ProofResult::SolvingTimeout;
-		else if (satisfiable == Satisfiability::Unsatisfiable)
-			proofResult = ProofResult::Proven;
-		else
-			proofResult = ProofResult::Unproven;
+			// Remove the rightmost windows first so that the other windows keep their positions
+			std::for_each(std::make_reverse_iterator(end), std::make_reverse_iterator(begin), [&](const auto j)
+			{
+				constraint = constraint->withoutLiterals(windowStarts[j], windowSize);
+			});
 
-		// Statistics
+			return GeneralizedConstraint(constraint);
+		};
+
+		const auto removedLiterals = [&](auto begin, auto end)
 		{
-			EventHypothesisTested event =
+			return std::accumulate(begin, end, static_cast<size_t>(0), [&](size_t sum, const auto j)
 			{
-				ProofType::InductionBaseProof,
-				purpose,
-				generalizedHypothesis.degree(),
-				generalizedHypothesis.numberOfLiterals(),
-				proofResult,
-				std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count()
-			};
-			*m_clasp.stdout() >> event.claspJSONOutput;
+				return sum + std::min(windowSize, result.numberOfLiterals() - windowStarts[j]);
+			});
+		};
 
-			m_events.notifyHypothesisTested(event);
+		const auto nextWindowStart = (stopWindow < windowStarts.size())
+			? windowStarts[stopWindow]
+			: windowStarts.back() + windowSize;
+
+		if (provenWindows.empty())
+		{
+			i = nextWindowStart;
+			windowSize = (stopWindow < windowStarts.size()) ? 1 : windowSize;
+			continue;
 		}
 
-		if (proofResult == ProofResult::Unproven
-			|| proofResult == ProofResult::GroundingTimeout
-			|| proofResult == ProofResult::SolvingTimeout)
-			return proofResult;
+		auto hypothesis = removeWindows(provenWindows.cbegin(), provenWindows.cend());
+		auto removedLiteralsBeforeNextWindow = removedLiterals(provenWindows.cbegin(), provenWindows.cend());
+
+		// Each window was only proven removable on its own, so the combination needs to be proven again
+		if (provenWindows.size() > 1)
+		{
+			const auto proofResult = (hypothesis.numberOfLiterals() == 0)
+				? ProofResult::Unproven
+				: testHypothesis(hypothesis, EventHypothesisTested::Purpose::Minimize);
+
+			if (proofResult == ProofResult::Proven)
+				requiredTests++;
+			else
+			{
+				if (hypothesis.numberOfLiterals() > 0)
+					speculativeTests++;
+
+				if (m_environment->logLevel() == LogLevel::Debug)
+					std::cout << "[Info ] Combined candidate property unproven, keeping the first window only" << std::endl;
+
+				// Only the first proven window is certain, all later windows have to be tested again
+				const auto firstProvenWindow = provenWindows.front();
+				const auto windowsTestedAgain = std::count_if(hypothesisTests.cbegin() + firstProvenWindow + 1,
+					hypothesisTests.cbegin() + std::min(stopWindow + 1, hypothesisTests.size()),
+					[](const auto &hypothesisTest) {return hypothesisTest != nullptr;});
+
+				requiredTests -= windowsTestedAgain;
+				speculativeTests += windowsTestedAgain;
+
+				hypothesis = removeWindows(provenWindows.cbegin(), provenWindows.cbegin() + 1);
+				removedLiteralsBeforeNextWindow = removedLiterals(provenWindows.cbegin(), provenWindows.cbegin() + 1);
+
+				result = hypothesis;
+				i = windowStarts[firstProvenWindow];
+				windowSize += linearIncrement;
+				continue;
+			}
+		}
+
+		result = hypothesis;
+		i = nextWindowStart - removedLiteralsBeforeNextWindow;
+		windowSize = (stopWindow < windowStarts.size()) ? 1 : windowSize + linearIncrement;
 	}
 
-	m_program.clear();
-	m_program.seekg(0, std::ios::beg);
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GeneralizedConstraint FeedbackLoop::minimizeConstraintQuickXplain(const GeneralizedConstraint &provenGeneralizedConstraint, size_t &requiredTests)
+{
+	std::vector<size_t> literals(provenGeneralizedConstraint.numberOfLiterals());
+	std::iota(literals.begin(), literals.end(), 0);
+
+	// The full constraint is already proven, so there is no need to test it again
+	auto requiredLiterals = quickXplain(provenGeneralizedConstraint, {}, false, literals, requiredTests);
+	std::sort(requiredLiterals.begin(), requiredLiterals.end());
+
+	return GeneralizedConstraint(provenGeneralizedConstraint.originalConstraint()->withLiterals(requiredLiterals));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	////////////////////////////////////////////////////////////////////////////////////////////////
-	// Induction Step
-	////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns a minimal subset of the candidate literals that, together with the background literals,
+// still forms a valid constraint. Removing literals only strengthens a constraint, so a constraint
+// that is not proven with some literals is not proven with any subset of them either
+std::vector<size_t> FeedbackLoop::quickXplain(const GeneralizedConstraint &provenGeneralizedConstraint,
+	const std::vector<size_t> &background, bool backgroundChanged, const std::vector<size_t> &candidates,
+	size_t &requiredTests)
+{
+	// Empty constraints are never valid
+	if (backgroundChanged && !background.empty())
 	{
-		std::stringstream inductionStepEncoding;
-		inductionStepEncoding
-			<< m_program.rdbuf();
+		auto literals = background;
+		std::sort(literals.begin(), literals.end());
 
-		if (m_configuration->fluentClosureUsage == FluentClosureUsage::UseFluentClosure)
-			inductionStepEncoding << FluentClosureEncoding;
-		else
-			inductionStepEncoding << StateGeneratorEncoding;
+		GeneralizedConstraint hypothesis(provenGeneralizedConstraint.originalConstraint()->withLiterals(literals));
 
-		inductionStepEncoding
-			<< "#const degree=" << (generalizedHypothesis.degree() + 1) << "." << std::endl
-			<< "hypothesisConstraint(T) ";
+		if (m_environment->logLevel() == LogLevel::Debug)
+			std::cout << "[Info ] Trying to eliminate " << candidates.size() << " literals at once" << std::endl;
 
-		generalizedHypothesis.print(inductionStepEncoding);
+		const auto proofResult = testHypothesis(hypothesis, EventHypothesisTested::Purpose::Minimize);
 
-		inductionStepEncoding
-			<< std::endl
-			<< InductionProofStepEncoding << std::endl;
+		requiredTests++;
 
-		std::for_each(m_learnedConstraints.cbegin(), m_learnedConstraints.cend(), [&](const auto &constraint)
-		{
-			GeneralizedConstraint(constraint).print(inductionStepEncoding);
-			inductionStepEncoding << std::endl;
-		});
+		if (proofResult == ProofResult::Unknown)
+			std::cerr << "[Error] Invalid proof result" << std::endl;
 
-		inductionStepEncoding.clear();
-		inductionStepEncoding.seekg(0, std::ios::beg);
+		// None of the candidates is required
+		if (proofResult == ProofResult::Proven)
+			return {};
+	}
 
-		bool groundingTimeout = false;
-		bool solvingTimeout = false;
+	if (candidates.size() <= 1)
+		return candidates;
 
-		const auto groundingStartTime = std::chrono::high_resolution_clock::now();
-		m_gringo.run(inductionStepEncoding, m_configuration->hypothesisTestingTimeout, groundingTimeout);
-		m_gringo.join();
-		const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+	const auto middle = candidates.cbegin() + candidates.size() / 2;
+	const std::vector<size_t> firstHalf(candidates.cbegin(), middle);
+	const std::vector<size_t> secondHalf(middle, candidates.cend());
 
-		auto satisfiable = Satisfiability::Unknown;
+	auto firstHalfWithBackground = background;
+	firstHalfWithBackground.insert(firstHalfWithBackground.end(), firstHalf.cbegin(), firstHalf.cend());
 
-		if (!groundingTimeout)
-		{
-			BOOST_ASSERT(m_gringo.stdout());
+	const auto requiredFromSecondHalf = quickXplain(provenGeneralizedConstraint, firstHalfWithBackground,
+		!firstHalf.empty(), secondHalf, requiredTests);
 
-			if (m_gringo.stderr() && parseForWarnings(*m_gringo.stderr()))
-				std::cout << "[Warn ] Warning while grounding: " << m_gringo.stderr()->rdbuf() << std::endl;
+	auto requiredFromSecondHalfWithBackground = background;
+	requiredFromSecondHalfWithBackground.insert(requiredFromSecondHalfWithBackground.end(),
+		requiredFromSecondHalf.cbegin(), requiredFromSecondHalf.cend());
 
-			m_clasp.run(*m_gringo.stdout(), m_configuration->hypothesisTestingTimeout, solvingTimeout);
-			m_clasp.join();
+	auto requiredLiterals = quickXplain(provenGeneralizedConstraint, requiredFromSecondHalfWithBackground,
+		!requiredFromSecondHalf.empty(), firstHalf, requiredTests);
 
-			BOOST_ASSERT(m_clasp.stdout());
-			satisfiable = parseForSatisfiability(*m_clasp.stdout());
-		}
+	requiredLiterals.insert(requiredLiterals.end(), requiredFromSecondHalf.cbegin(), requiredFromSecondHalf.cend());
 
-		auto proofResult = ProofResult::Unknown;
+	return requiredLiterals;
+}
 
-		if (groundingTimeout)
-			proofResult = ProofResult::GroundingTimeout;
-		else if (solvingTimeout)
-			proofResult = ProofResult::SolvingTimeout;
-		else if (satisfiable == Satisfiability::Unsatisfiable)
-			proofResult = ProofResult::Proven;
-		else
-			proofResult = ProofResult::Unproven;
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		// Statistics
-		{
-			EventHypothesisTested event =
-			{
-				ProofType::InductionStepProof,
-				purpose,
-				generalizedHypothesis.degree(),
-				generalizedHypothesis.numberOfLiterals(),
-				proofResult,
-				std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count()
-			};
-			*m_clasp.stdout() >> event.claspJSONOutput;
+GeneralizedConstraint FeedbackLoop::minimizeConstraintWithUnsatCores(const GeneralizedConstraint &provenGeneralizedConstraint, size_t &requiredTests)
+{
+	auto result = provenGeneralizedConstraint;
 
-			m_events.notifyHypothesisTested(event);
+	// Cores are not necessarily minimal, so repeat until the core does not shrink anymore
+	while (true)
+	{
+		std::vector<size_t> requiredLiterals;
+
+		if (!findRequiredLiterals(result, requiredLiterals, requiredTests)
+			|| requiredLiterals.empty()
+			|| requiredLiterals.size() == result.numberOfLiterals())
+		{
+			break;
 		}
 
-		return proofResult;
+		if (m_environment->logLevel() == LogLevel::Debug)
+			std::cout << "[Info ] Trying to eliminate " << (result.numberOfLiterals() - requiredLiterals.size())
+				<< " literals outside of the unsatisfiable core" << std::endl;
+
+		GeneralizedConstraint hypothesis(result.originalConstraint()->withLiterals(requiredLiterals));
+
+		// The literals are dropped from all occurrences of the hypothesis at once, which the cores of
+		// induction step proofs do not account for, so the reduced constraint must be proven again
+		const auto proofResult = testHypothesis(hypothesis, EventHypothesisTested::Purpose::Minimize);
+
+		requiredTests++;
+
+		if (proofResult != ProofResult::Proven)
+		{
+			if (m_environment->logLevel() == LogLevel::Debug)
+				std::cout << "[Info ] Core-reduced candidate property unproven, minimizing linearly" << std::endl;
+
+			return minimizeConstraintSequentially(result, 1, requiredTests);
+		}
+
+		result = hypothesis;
+	}
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FeedbackLoop::findRequiredLiterals(const GeneralizedConstraint &generalizedHypothesis, std::vector<size_t> &requiredLiterals, size_t &requiredTests)
+{
+	std::vector<ClingoSolver::Assumption> assumptions;
+	assumptions.reserve(generalizedHypothesis.numberOfLiterals());
+
+	for (size_t i = 0; i < generalizedHypothesis.numberOfLiterals(); i++)
+		assumptions.emplace_back("keep(" + std::to_string(i) + ")", true);
+
+	// Models are not needed, as only the cores are used
+	Prover prover(*m_environment, m_configuration->solverBackend, m_configuration->pipelineProcesses, false);
+	std::vector<bool> isRequired(assumptions.size(), false);
+
+	// Collects the literals in the core of a single proof
+	const auto prove = [&](ProofType proofType, Encoding &&proofEncoding)
+	{
+		EventHypothesisTested event =
+		{
+			proofType,
+			EventHypothesisTested::Purpose::Minimize,
+			generalizedHypothesis.degree(),
+			generalizedHypothesis.numberOfLiterals()
+		};
+
+		const auto proofResult = prover.prove(proofEncoding, assumptions, m_configuration->hypothesisTestingTimeout, event);
+
+		// Statistics
+		m_events.notifyHypothesisTested(event);
+
+		if (proofResult != ProofResult::Proven)
+			return false;
+
+		std::for_each(prover.core().cbegin(), prover.core().cend(), [&](const auto &atom)
+		{
+			const auto match = std::find_if(assumptions.cbegin(), assumptions.cend(),
+				[&](const auto &assumption) {return assumption.first == atom;});
+
+			BOOST_ASSERT(match != assumptions.cend());
+
+			isRequired[match - assumptions.cbegin()] = true;
+		});
+
+		return true;
+	};
+
+	const auto proveStateWise = [&]()
+	{
+		return prove(ProofType::StateWiseProof, encodeStateWiseProof(generalizedHypothesis, true));
+	};
+
+	const auto proveInduction = [&]()
+	{
+		return prove(ProofType::InductionBaseProof, encodeInductionBaseProof(generalizedHypothesis, true))
+			&& prove(ProofType::InductionStepProof, encodeInductionStepProof(generalizedHypothesis, true));
+	};
+
+	requiredTests++;
+
+	bool proven = false;
+
+	switch (m_configuration->proofMethod)
+	{
+		case ProofMethod::StateWiseProof:
+			proven = proveStateWise();
+			break;
+		case ProofMethod::InductionProof:
+			proven = proveInduction();
+			break;
+		case ProofMethod::Portfolio:
+			proven = proveStateWise();
+
+			if (!proven)
+			{
+				std::fill(isRequired.begin(), isRequired.end(), false);
+				proven = proveInduction();
+			}
+
+			break;
+		default:
+			std::cerr << "[Error] Unknown proof method" << std::endl;
+			break;
+	}
+
+	if (!proven)
+		return false;
+
+	requiredLiterals.clear();
+
+	for (size_t i = 0; i < isRequired.size(); i++)
+		if (isRequired[i])
+			requiredLiterals.push_back(i);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult FeedbackLoop::testHypothesis(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose)
+{
+	auto proofResult = ProofResult::Unknown;
+
+	if (findCachedProofResult(generalizedHypothesis, purpose, proofResult))
+		return proofResult;
+
+	if (refuteWithCounterexamples(generalizedHypothesis, purpose, proofResult))
+		return proofResult;
+
+	auto explicitProofResult = ProofResult::Unknown;
+	const auto isCheckedExplicitly = checkExplicitStates(generalizedHypothesis, purpose, explicitProofResult);
+
+	if (isCheckedExplicitly && m_configuration->explicitStateChecking != ExplicitStateChecking::CrossCheckExplicitStateChecking)
+		return explicitProofResult;
+
+	if (m_configuration->solverBackend == SolverBackend::ClingoIncremental)
+		proofResult = testHypothesisWithProofSessions(generalizedHypothesis, purpose);
+	else
+	{
+		auto hypothesisTest = makeHypothesisTest(generalizedHypothesis, purpose);
+
+		proofResult = hypothesisTest->run();
+
+		storeCounterexamples(hypothesisTest->counterexamples());
+
+		// Statistics
+		std::for_each(hypothesisTest->events().cbegin(), hypothesisTest->events().cend(), [&](const auto &event)
+		{
+			m_events.notifyHypothesisTested(event);
+		});
+	}
+
+	if (isCheckedExplicitly && (proofResult == ProofResult::Proven || proofResult == ProofResult::Unproven)
+		&& proofResult != explicitProofResult)
+	{
+		std::cerr << "[Error] Explicit-state checker (" << explicitProofResult << ") disagrees with solver ("
+			<< proofResult << ") on hypothesis " << generalizedHypothesis << std::endl;
 	}
+
+	cacheProofResult(generalizedHypothesis, m_learnedConstraints.size(), proofResult);
+
+	return proofResult;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FeedbackLoop::findCachedProofResult(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose, ProofResult &proofResult)
+{
+	const auto hit = m_proofCache.find(generalizedHypothesis, m_configuration->proofMethod, m_learnedConstraints.size(), proofResult);
+
+	if (hit && m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Reused proof result of equivalent hypothesis (" << proofResult << ")" << std::endl;
+
+	// Statistics
+	EventProofCacheAccessed event =
+	{
+		purpose,
+		generalizedHypothesis.degree(),
+		generalizedHypothesis.numberOfLiterals(),
+		hit,
+		hit ? proofResult : ProofResult::Unknown
+	};
+
+	m_events.notifyProofCacheAccessed(event);
+
+	return hit;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::cacheProofResult(const GeneralizedConstraint &generalizedHypothesis, size_t learnedConstraints, ProofResult proofResult)
+{
+	m_proofCache.insert(generalizedHypothesis, m_configuration->proofMethod, learnedConstraints, proofResult);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FeedbackLoop::refuteWithCounterexamples(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose, ProofResult &proofResult)
+{
+	if (!m_configuration->keepCounterexamples
+		|| !m_counterexampleStore.refutes(generalizedHypothesis, m_configuration->proofMethod))
+	{
+		return false;
+	}
+
+	proofResult = ProofResult::Unproven;
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Refuted hypothesis with a counterexample of an earlier proof" << std::endl;
+
+	// Statistics
+	EventHypothesisRefuted event =
+	{
+		purpose,
+		generalizedHypothesis.degree(),
+		generalizedHypothesis.numberOfLiterals(),
+		m_counterexampleStore.size()
+	};
+
+	m_events.notifyHypothesisRefuted(event);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::storeCounterexamples(const std::vector<Counterexample> &counterexamples)
+{
+	std::for_each(counterexamples.cbegin(), counterexamples.cend(), [&](const auto &counterexample)
+	{
+		m_counterexampleStore.insert(counterexample);
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FeedbackLoop::checkExplicitStates(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose, ProofResult &proofResult)
+{
+	if (!m_simulator || m_configuration->explicitStateChecking == ExplicitStateChecking::NoExplicitStateChecking
+		|| m_configuration->proofMethod == ProofMethod::InductionProof)
+	{
+		return false;
+	}
+
+	const auto startTime = std::chrono::high_resolution_clock::now();
+	auto explicitProofResult = ProofResult::Unknown;
+
+	if (!m_simulator->checkStateWiseProof(*generalizedHypothesis.originalConstraint(), m_learnedConstraints,
+		m_configuration->fluentClosureUsage, m_configuration->explicitStateBound, explicitProofResult))
+	{
+		return false;
+	}
+
+	// With the portfolio, unsuccessful state-wise proofs leave the induction proof to be done
+	if (m_configuration->proofMethod == ProofMethod::Portfolio && explicitProofResult != ProofResult::Proven)
+		return false;
+
+	proofResult = explicitProofResult;
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Checked hypothesis explicitly (" << proofResult << ")" << std::endl;
+
+	// Statistics
+	EventExplicitStateChecked event =
+	{
+		purpose,
+		generalizedHypothesis.degree(),
+		generalizedHypothesis.numberOfLiterals(),
+		proofResult,
+		std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count()
+	};
+
+	m_events.notifyExplicitStateChecked(event);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::reduceProgram()
+{
+	const auto startTime = std::chrono::high_resolution_clock::now();
+
+	std::vector<std::string> atoms;
+
+	if (!RelevanceAnalysis::computeFacts(*m_encodingBuilder.program(), atoms))
+	{
+		std::cout << "[Warn ] Instance and domain are not plain facts, proving without relevance analysis" << std::endl;
+		return;
+	}
+
+	std::unique_ptr<RelevanceAnalysis> relevanceAnalysis;
+
+	try
+	{
+		relevanceAnalysis = std::make_unique<RelevanceAnalysis>(atoms, m_environment->symbolTable());
+	}
+	catch (const std::exception &e)
+	{
+		std::cout << "[Warn ] Could not analyze instance and domain facts: " << e.what() << std::endl;
+		return;
+	}
+
+	m_encodingBuilder.setProgram(relevanceAnalysis->reducedProgram());
+
+	EventProgramReduced event;
+	event.facts = relevanceAnalysis->numberOfFacts();
+	event.reducedFacts = relevanceAnalysis->numberOfReducedFacts();
+	event.fluents = relevanceAnalysis->numberOfFluents();
+	event.reachableFluents = relevanceAnalysis->numberOfReachableFluents();
+	event.staticFluents = relevanceAnalysis->numberOfStaticFluents();
+	event.actions = relevanceAnalysis->numberOfActions();
+	event.reachableActions = relevanceAnalysis->numberOfReachableActions();
+	event.reductionTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+	m_events.notifyProgramReduced(event);
+
+	std::cout << "[Info ] Reduced instance to " << event.reducedFacts << "/" << event.facts << " facts ("
+		<< event.reachableActions << "/" << event.actions << " actions, "
+		<< event.reachableFluents << "/" << event.fluents << " fluents, "
+		<< event.staticFluents << " static)" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::precomputeFluentClosure()
+{
+	const auto startTime = std::chrono::high_resolution_clock::now();
+
+	// Brave consequences over-approximate the closure if the instance has several answer sets
+	ClingoSolver solver({"--enum-mode=brave", "--models=0"});
+
+	bool groundingTimeout = false;
+	bool solvingTimeout = false;
+
+	Encoding fluentClosureEncoding;
+	fluentClosureEncoding.append(m_encodingBuilder.program());
+	fluentClosureEncoding.append(FluentClosureEncoding + "#show fluentClosure/1.\n");
+
+	const auto satisfiability = solver.solve(fluentClosureEncoding, {},
+		m_configuration->hypothesisTestingTimeout, groundingTimeout, solvingTimeout);
+
+	if (satisfiability != Satisfiability::Satisfiable)
+	{
+		std::cout << "[Warn ] Could not precompute fluent closure, computing it with every proof" << std::endl;
+		return;
+	}
+
+	EventFluentClosurePrecomputed event;
+	event.fluents = 0;
+
+	std::stringstream fluentClosure;
+
+	// The instance may show further atoms
+	for (const auto &atom : solver.model())
+	{
+		if (atom.compare(0, 14, "fluentClosure(") != 0)
+			continue;
+
+		fluentClosure << atom << "." << std::endl;
+		event.fluents++;
+	}
+
+	fluentClosure << PrecomputedFluentClosureEncoding;
+
+	m_precomputedFluentClosure = fluentClosure.str();
+
+	event.precomputationTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+	m_events.notifyFluentClosurePrecomputed(event);
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Precomputed fluent closure with " << event.fluents << " fluents" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string &FeedbackLoop::stateGeneratorEncoding() const
+{
+	if (m_configuration->fluentClosureUsage != FluentClosureUsage::UseFluentClosure)
+		return StateGeneratorEncoding;
+
+	if (!m_precomputedFluentClosure.empty())
+		return m_precomputedFluentClosure;
+
+	return FluentClosureEncoding;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::readTransitionSystem()
+{
+	const auto &program = *m_encodingBuilder.program();
+
+	// The simulator only knows the transition system given by the facts, so it cannot be used if the
+	// instance or domain constrain the states otherwise
+	if (program.find("holds(") != std::string::npos || program.find("apply(") != std::string::npos)
+	{
+		std::cout << "[Warn ] Instance or domain refer to states directly, proving without simulation" << std::endl;
+		return;
+	}
+
+	std::vector<std::string> atoms;
+
+	// States explored by the simulator are only those of all models if the facts do not depend on the model
+	if (!ClingoSolver::computeUniqueModel(program + Simulator::FactsEncoding, m_configuration->hypothesisTestingTimeout,
+		atoms))
+	{
+		std::cout << "[Warn ] Instance and domain facts are not unique, proving without simulation" << std::endl;
+		return;
+	}
+
+	m_simulator = std::make_unique<Simulator>(atoms, m_environment->symbolTable());
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+	{
+		std::cout << "[Info ] Read transition system with " << m_simulator->numberOfFluents() << " fluents and "
+			<< m_simulator->numberOfActions() << " actions" << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::simulateTraces()
+{
+	BOOST_ASSERT(m_simulator);
+
+	const auto &simulator = *m_simulator;
+
+	// Induction steps span one more time step than the hypothesis
+	const auto horizon = std::min<size_t>(m_configuration->maxDegree, m_configuration->horizon) + 1;
+	const auto walks = m_configuration->simulatedWalks;
+
+	std::mt19937 generator(0);
+
+	const auto insert = [&](const std::vector<Counterexample> &traces)
+	{
+		std::for_each(traces.cbegin(), traces.cend(), [&](const auto &trace)
+		{
+			m_simulatedTraces.insert(trace);
+		});
+	};
+
+	insert(simulator.exploreBreadthFirst(horizon, walks));
+	insert(simulator.walkFromInitialState(horizon, walks, generator));
+	insert(simulator.walkFromFluentClosure(horizon, walks, generator));
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Simulated " << m_simulatedTraces.size() << " traces" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::filterFeedbackBySimulation()
+{
+	const auto startTime = std::chrono::high_resolution_clock::now();
+	const auto testedHypotheses = m_feedback.size();
+
+	m_feedback.erase(std::remove_if(m_feedback.begin(), m_feedback.end(), [&](const auto &constraint)
+	{
+		return m_simulatedTraces.refutes(GeneralizedConstraint(constraint), m_configuration->proofMethod);
+	}), m_feedback.end());
+
+	const auto refutedHypotheses = testedHypotheses - m_feedback.size();
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+		std::cout << "[Info ] Refuted " << refutedHypotheses << " hypotheses by simulation" << std::endl;
+
+	// Statistics
+	EventFeedbackSimulated event =
+	{
+		testedHypotheses,
+		refutedHypotheses,
+		m_simulatedTraces.size(),
+		std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count()
+	};
+
+	m_events.notifyFeedbackSimulated(event);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<HypothesisTest> FeedbackLoop::makeHypothesisTest(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose)
+{
+	auto hypothesisTest = std::make_unique<HypothesisTest>(*m_environment, m_configuration->solverBackend,
+		m_configuration->pipelineProcesses, m_configuration->keepCounterexamples, m_configuration->hypothesisTestingTimeout, generalizedHypothesis, purpose);
+
+	// Proofs are appended to the ground transition systems if these are pregrounded
+	const auto addProof = [&](ProofMethod proofMethod, ProofType proofType, size_t degree, auto encode)
+	{
+		auto groundTransitionSystem = pregroundTransitionSystem(proofType, degree);
+
+		hypothesisTest->addProof(proofMethod, proofType,
+			(this->*encode)(generalizedHypothesis, false, groundTransitionSystem.get()), std::move(groundTransitionSystem));
+	};
+
+	// The induction step needs one more time step than the degree of the hypothesis
+	const auto degree = generalizedHypothesis.degree();
+
+	switch (m_configuration->proofMethod)
+	{
+		case ProofMethod::StateWiseProof:
+			addProof(ProofMethod::StateWiseProof, ProofType::StateWiseProof, degree, &FeedbackLoop::encodeStateWiseProof);
+			break;
+		case ProofMethod::InductionProof:
+			addProof(ProofMethod::InductionProof, ProofType::InductionBaseProof, degree, &FeedbackLoop::encodeInductionBaseProof);
+			addProof(ProofMethod::InductionProof, ProofType::InductionStepProof, degree + 1, &FeedbackLoop::encodeInductionStepProof);
+			break;
+		case ProofMethod::Portfolio:
+			addProof(ProofMethod::StateWiseProof, ProofType::StateWiseProof, degree, &FeedbackLoop::encodeStateWiseProof);
+			addProof(ProofMethod::InductionProof, ProofType::InductionBaseProof, degree, &FeedbackLoop::encodeInductionBaseProof);
+			addProof(ProofMethod::InductionProof, ProofType::InductionStepProof, degree + 1, &FeedbackLoop::encodeInductionStepProof);
+			break;
+		default:
+			std::cerr << "[Error] Unknown proof method" << std::endl;
+			break;
+	}
+
+	return hypothesisTest;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::encodeHypothesis(std::ostream &ostream, const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals)
+{
+	if (!guardLiterals)
+	{
+		ostream << "hypothesisConstraint(T) " << generalizedHypothesis << std::endl;
+		return;
+	}
+
+	const auto &literals = generalizedHypothesis.originalConstraint()->literals();
+
+	BOOST_ASSERT(!literals.empty());
+
+	ostream
+		<< "{keep(0.." << (literals.size() - 1) << ")}." << std::endl
+		// Dropped literals are always satisfied
+		<< "hypothesisLiteral(I, T) :- time(T), I = 0.." << (literals.size() - 1) << ", not keep(I)." << std::endl;
+
+	for (size_t i = 0; i < literals.size(); i++)
+	{
+		ostream << "hypothesisLiteral(" << i << ", T) :- time(T), ";
+		literals[i].print(ostream, Literal::OutputFormat::Generalized, generalizedHypothesis.offset());
+		ostream << "." << std::endl;
+	}
+
+	ostream << "hypothesisConstraint(T) :- ";
+
+	for (size_t t = 0; t <= generalizedHypothesis.degree(); t++)
+	{
+		ostream << "time(T";
+
+		if (t > 0)
+			ostream << "+" << t;
+
+		ostream << "), ";
+	}
+
+	for (size_t i = 0; i < literals.size(); i++)
+	{
+		if (i != 0)
+			ostream << ", ";
+
+		ostream << "hypothesisLiteral(" << i << ", T)";
+	}
+
+	ostream << "." << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Encoding FeedbackLoop::encodeStateWiseProof(const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals,
+	const GroundProgram *groundTransitionSystem)
+{
+	return encodeProof(ProofType::StateWiseProof, generalizedHypothesis.degree(), generalizedHypothesis,
+		guardLiterals, StateWiseProofCheckEncoding, groundTransitionSystem);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Encoding FeedbackLoop::encodeInductionBaseProof(const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals,
+	const GroundProgram *groundTransitionSystem)
+{
+	return encodeProof(ProofType::InductionBaseProof, generalizedHypothesis.degree(), generalizedHypothesis,
+		guardLiterals, InductionProofBaseCheckEncoding, groundTransitionSystem);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Encoding FeedbackLoop::encodeInductionStepProof(const GeneralizedConstraint &generalizedHypothesis, bool guardLiterals,
+	const GroundProgram *groundTransitionSystem)
+{
+	return encodeProof(ProofType::InductionStepProof, generalizedHypothesis.degree() + 1, generalizedHypothesis,
+		guardLiterals, InductionProofStepCheckEncoding, groundTransitionSystem);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Encoding FeedbackLoop::encodeProof(ProofType proofType, size_t degree, const GeneralizedConstraint &generalizedHypothesis,
+	bool guardLiterals, const std::string &checkEncoding, const GroundProgram *groundTransitionSystem)
+{
+	Encoding proofEncoding;
+
+	encodeTransitionSystem(proofEncoding, proofType, degree, groundTransitionSystem);
+
+	std::stringstream hypothesisEncoding;
+	encodeHypothesis(hypothesisEncoding, generalizedHypothesis, guardLiterals);
+
+	hypothesisEncoding
+		<< checkEncoding << std::endl
+		<< CounterexampleEncoding;
+
+	proofEncoding.append(hypothesisEncoding.str());
+	proofEncoding.append(m_encodingBuilder.learnedConstraints());
+
+	return proofEncoding;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::encodeTransitionSystem(Encoding &encoding, ProofType proofType, size_t degree,
+	const GroundProgram *groundTransitionSystem)
+{
+	if (groundTransitionSystem)
+	{
+		// The hypothesis is grounded against the shown atoms of the transition system only
+		encoding.append(groundTransitionSystem->interfaceEncoding());
+		encoding.append("time(0.." + std::to_string(degree) + ").\n");
+		return;
+	}
+
+	std::stringstream transitionRules;
+	encodeTransitionRules(transitionRules, proofType, degree);
+
+	encoding.append(m_encodingBuilder.program());
+	encoding.append(transitionRules.str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::encodeTransitionRules(std::ostream &ostream, ProofType proofType, size_t degree)
+{
+	switch (proofType)
+	{
+		case ProofType::StateWiseProof:
+			ostream
+				<< stateGeneratorEncoding()
+				<< "#const degree=" << degree << "." << std::endl
+				<< StateWiseProofEncoding << std::endl;
+			break;
+		case ProofType::InductionBaseProof:
+			ostream
+				<< "#const degree=" << degree << "." << std::endl
+				<< InductionProofBaseEncoding << std::endl;
+			break;
+		case ProofType::InductionStepProof:
+			ostream
+				<< stateGeneratorEncoding()
+				<< "#const degree=" << degree << "." << std::endl
+				<< InductionProofStepEncoding << std::endl;
+			break;
+		default:
+			std::cerr << "[Error] Unknown proof type" << std::endl;
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::shared_ptr<const GroundProgram> FeedbackLoop::pregroundTransitionSystem(ProofType proofType, size_t degree)
+{
+	// Ground programs can only be passed to clasp directly
+	if (!m_configuration->pregroundTransitionSystems || m_configuration->solverBackend != SolverBackend::Process)
+		return nullptr;
+
+	const auto key = std::make_tuple(proofType, degree);
+	const auto match = m_groundTransitionSystems.find(key);
+
+	if (match != m_groundTransitionSystems.end())
+		return match->second;
+
+	// Failed groundings are remembered as null programs, which are not used
+	auto &groundTransitionSystem = m_groundTransitionSystems[key];
+
+	AsyncProcess gringo(m_environment->gringoConfiguration());
+
+	std::stringstream transitionRules;
+	encodeTransitionRules(transitionRules, proofType, degree);
+
+	// The shown atoms make up the interface that the proofs are grounded against
+	Encoding transitionSystemEncoding;
+	transitionSystemEncoding.append(m_encodingBuilder.program());
+	transitionSystemEncoding.append(transitionRules.str());
+	transitionSystemEncoding.append(CounterexampleEncoding);
+
+	const auto groundingStartTime = std::chrono::high_resolution_clock::now();
+
+	bool groundingTimeout = false;
+	gringo.run(transitionSystemEncoding, m_configuration->hypothesisTestingTimeout, groundingTimeout);
+	gringo.join();
+
+	const auto groundingTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - groundingStartTime).count();
+
+	auto groundProgram = std::make_shared<GroundProgram>();
+
+	if (groundingTimeout || gringo.exitCode() != 0 || !gringo.stdout() || !groundProgram->read(gringo.stdout()->str()))
+	{
+		std::cout << "[Warn ] Could not preground transition system (" << proofType << ", degree: " << degree
+			<< "), grounding it with each proof" << std::endl;
+		return nullptr;
+	}
+
+	groundTransitionSystem = std::move(groundProgram);
+
+	if (m_environment->logLevel() == LogLevel::Debug)
+	{
+		std::cout << "[Info ] Pregrounded transition system (" << proofType << ", degree: " << degree
+			<< ") in " << groundingTime << " s" << std::endl;
+	}
+
+	return groundTransitionSystem;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FeedbackLoop::groundProofBatch(const GeneralizedConstraint &generalizedHypothesis)
+{
+	if (m_configuration->solverBackend != SolverBackend::ClingoIncremental || m_configuration->proofBatchSize <= 1)
+		return;
+
+	std::vector<GeneralizedConstraint> batch = {generalizedHypothesis};
+
+	// The feedback is sorted by degree in descending order, so the next hypotheses are at the back
+	for (auto constraint = m_feedback.rbegin(); constraint != m_feedback.rend()
+		&& batch.size() < m_configuration->proofBatchSize; constraint++)
+	{
+		GeneralizedConstraint nextHypothesis(*constraint);
+
+		if (nextHypothesis.degree() != generalizedHypothesis.degree())
+			break;
+
+		batch.push_back(std::move(nextHypothesis));
+	}
+
+	switch (m_configuration->proofMethod)
+	{
+		case ProofMethod::StateWiseProof:
+			m_stateWiseProofSession.groundHypotheses(batch);
+			break;
+		case ProofMethod::InductionProof:
+			m_inductionBaseProofSession.groundHypotheses(batch);
+			m_inductionStepProofSession.groundHypotheses(batch);
+			break;
+		default:
+			break;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult FeedbackLoop::testHypothesisWithProofSessions(const GeneralizedConstraint &generalizedHypothesis, EventHypothesisTested::Purpose purpose)
+{
+	std::vector<EventHypothesisTested> events;
+
+	const auto prove = [&](ProofSession &proofSession, ProofType proofType)
+	{
+		EventHypothesisTested event =
+		{
+			proofType,
+			purpose,
+			generalizedHypothesis.degree(),
+			generalizedHypothesis.numberOfLiterals()
+		};
+
+		auto proofResult = proofSession.prove(generalizedHypothesis, m_learnedConstraints,
+			m_configuration->hypothesisTestingTimeout, event);
+
+		if (proofResult == ProofResult::Unproven && m_configuration->keepCounterexamples)
+		{
+			// The induction step needs one more time step than the degree of the hypothesis
+			const auto horizon = generalizedHypothesis.degree() + (proofType == ProofType::InductionStepProof ? 1 : 0);
+
+			m_counterexampleStore.insert({proofType == ProofType::InductionBaseProof, horizon, proofSession.model()});
+		}
+
+		if (proofResult == ProofResult::Unknown)
+		{
+			// Induction proofs without a definite answer are not successful
+			if (proofType == ProofType::StateWiseProof)
+				std::cout << "[Warn ] Proof result is unknown" << std::endl;
+			else
+				proofResult = event.proofResult = ProofResult::Unproven;
+		}
+
+		events.push_back(event);
+
+		return proofResult;
+	};
+
+	const auto proveStateWise = [&]()
+	{
+		return prove(m_stateWiseProofSession, ProofType::StateWiseProof);
+	};
+
+	const auto proveInduction = [&]()
+	{
+		const auto proofResult = prove(m_inductionBaseProofSession, ProofType::InductionBaseProof);
+
+		if (proofResult != ProofResult::Proven)
+			return proofResult;
+
+		return prove(m_inductionStepProofSession, ProofType::InductionStepProof);
+	};
+
+	auto proofResult = ProofResult::Unknown;
+	auto winningProofMethod = ProofMethod::Unknown;
+
+	switch (m_configuration->proofMethod)
+	{
+		case ProofMethod::StateWiseProof:
+			proofResult = proveStateWise();
+			winningProofMethod = ProofMethod::StateWiseProof;
+			break;
+		case ProofMethod::InductionProof:
+			proofResult = proveInduction();
+			winningProofMethod = ProofMethod::InductionProof;
+			break;
+		default:
+			std::cerr << "[Error] Unknown proof method" << std::endl;
+			break;
+	}
+
+	// Statistics
+	std::for_each(events.begin(), events.end(), [&](auto &event)
+	{
+		event.winningProofMethod = (proofResult == ProofResult::Proven) ? winningProofMethod : ProofMethod::Unknown;
+		m_events.notifyHypothesisTested(event);
+	});
+
+	return proofResult;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
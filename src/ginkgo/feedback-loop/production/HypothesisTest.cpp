@@ -0,0 +1,244 @@
+#include <ginkgo/feedback-loop/production/HypothesisTest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// HypothesisTest
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+HypothesisTest::HypothesisTest(const Environment &environment, SolverBackend solverBackend, bool pipelineProcesses,
+	bool keepCounterexamples, const std::chrono::milliseconds &timeout, const GeneralizedConstraint &hypothesis,
+	EventHypothesisTested::Purpose purpose)
+:	m_environment(environment),
+	m_solverBackend{solverBackend},
+	m_pipelineProcesses{pipelineProcesses},
+	m_keepCounterexamples{keepCounterexamples},
+	m_timeout{timeout},
+	m_hypothesis{hypothesis},
+	m_purpose{purpose},
+	m_cancelled{false}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void HypothesisTest::addProof(ProofMethod proofMethod, ProofType proofType, Encoding &&proofEncoding,
+	std::shared_ptr<const GroundProgram> groundProgram)
+{
+	m_proofs.push_back({proofMethod, proofType, std::move(proofEncoding), std::move(groundProgram), std::make_unique<Prover>(m_environment, m_solverBackend, m_pipelineProcesses, m_keepCounterexamples), ProofResult::Unknown});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult HypothesisTest::run()
+{
+	if (m_proofs.empty())
+		return ProofResult::Unknown;
+
+	std::vector<EventHypothesisTested> events;
+	events.reserve(m_proofs.size());
+
+	std::for_each(m_proofs.cbegin(), m_proofs.cend(), [&](const auto &proof)
+	{
+		EventHypothesisTested event =
+		{
+			proof.proofType,
+			m_purpose,
+			m_hypothesis.degree(),
+			m_hypothesis.numberOfLiterals()
+		};
+
+		events.push_back(event);
+	});
+
+	std::mutex finishedProofsMutex;
+	std::condition_variable finishedProofsCondition;
+	std::deque<size_t> finishedProofs;
+
+	std::vector<std::thread> threads;
+	threads.reserve(m_proofs.size());
+
+	for (size_t i = 0; i < m_proofs.size(); i++)
+		threads.emplace_back([&, i]()
+		{
+			auto &proof = m_proofs[i];
+			proof.proofResult = proof.groundProgram
+				? proof.prover->prove(*proof.groundProgram, proof.encoding, m_timeout, events[i])
+				: proof.prover->prove(proof.encoding, m_timeout, events[i]);
+
+			std::lock_guard<std::mutex> lock(finishedProofsMutex);
+			finishedProofs.push_back(i);
+			finishedProofsCondition.notify_one();
+		});
+
+	// Proof methods that have failed, and the number of proofs each method still needs to succeed
+	std::vector<ProofMethod> failedProofMethods;
+	std::map<ProofMethod, size_t> pendingProofs;
+
+	std::for_each(m_proofs.cbegin(), m_proofs.cend(), [&](const auto &proof)
+	{
+		pendingProofs[proof.proofMethod]++;
+	});
+
+	const auto cancelProofs = [&](auto predicate)
+	{
+		for (size_t i = 0; i < m_proofs.size(); i++)
+			if (predicate(m_proofs[i]))
+				m_proofs[i].prover->cancel();
+	};
+
+	auto proofResult = ProofResult::Unknown;
+	auto winningProofMethod = ProofMethod::Unknown;
+
+	// Handle the proofs in the order they finish, so that the first decisive result counts
+	for (size_t i = 0; i < m_proofs.size(); i++)
+	{
+		size_t finishedProof;
+
+		{
+			std::unique_lock<std::mutex> lock(finishedProofsMutex);
+			finishedProofsCondition.wait(lock, [&]() {return !finishedProofs.empty();});
+
+			finishedProof = finishedProofs.front();
+			finishedProofs.pop_front();
+		}
+
+		auto &proof = m_proofs[finishedProof];
+		auto &event = events[finishedProof];
+
+		if (proof.prover->isCancelled() || winningProofMethod != ProofMethod::Unknown)
+			continue;
+
+		if (proof.proofResult == ProofResult::Unknown)
+		{
+			// Induction proofs without a definite answer are not successful
+			if (proof.proofType == ProofType::StateWiseProof)
+				std::cout << "[Warn ] Proof result is unknown" << std::endl;
+			else
+				proof.proofResult = event.proofResult = ProofResult::Unproven;
+		}
+
+		const auto proofMethod = proof.proofMethod;
+
+		if (std::find(failedProofMethods.cbegin(), failedProofMethods.cend(), proofMethod) != failedProofMethods.cend())
+			continue;
+
+		if (proof.proofResult != ProofResult::Proven)
+		{
+			failedProofMethods.push_back(proofMethod);
+
+			// Keep the first failure as the result in case no other method succeeds
+			if (proofResult == ProofResult::Unknown)
+				proofResult = proof.proofResult;
+
+			cancelProofs([&](const auto &otherProof)
+			{
+				return otherProof.proofMethod == proofMethod && &otherProof != &proof;
+			});
+
+			continue;
+		}
+
+		pendingProofs[proofMethod]--;
+
+		if (pendingProofs[proofMethod] > 0)
+			continue;
+
+		winningProofMethod = proofMethod;
+		proofResult = ProofResult::Proven;
+
+		cancelProofs([&](const auto &otherProof)
+		{
+			return otherProof.proofMethod != proofMethod;
+		});
+	}
+
+	std::for_each(threads.begin(), threads.end(), [](auto &thread)
+	{
+		thread.join();
+	});
+
+	if (m_cancelled)
+		return ProofResult::Unknown;
+
+	// Events are recorded in a fixed order, regardless of which proof finished first
+	for (size_t i = 0; i < m_proofs.size(); i++)
+	{
+		events[i].cancelled = m_proofs[i].prover->isCancelled() && m_proofs[i].proofResult == ProofResult::Unknown;
+		events[i].winningProofMethod = winningProofMethod;
+		m_events.push_back(events[i]);
+
+		const auto &proof = m_proofs[i];
+
+		if (!m_keepCounterexamples || proof.proofResult != ProofResult::Unproven || proof.prover->model().empty())
+			continue;
+
+		// The induction step needs one more time step than the degree of the hypothesis
+		const auto horizon = m_hypothesis.degree() + (proof.proofType == ProofType::InductionStepProof ? 1 : 0);
+
+		m_counterexamples.push_back({proof.proofType == ProofType::InductionBaseProof, horizon, proof.prover->model()});
+	}
+
+	return proofResult;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void HypothesisTest::cancel()
+{
+	m_cancelled = true;
+
+	std::for_each(m_proofs.begin(), m_proofs.end(), [](auto &proof)
+	{
+		proof.prover->cancel();
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool HypothesisTest::isCancelled()
+{
+	return m_cancelled;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const GeneralizedConstraint &HypothesisTest::hypothesis() const
+{
+	return m_hypothesis;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<EventHypothesisTested> &HypothesisTest::events() const
+{
+	return m_events;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Counterexample> &HypothesisTest::counterexamples() const
+{
+	return m_counterexamples;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -21,7 +21,9 @@ using MinimizationStrategyNames = boost::bimap<MinimizationStrategy, std::string
 static MinimizationStrategyNames minimizationStrategyNames = boost::assign::list_of<MinimizationStrategyNames::relation>
 	(MinimizationStrategy::NoMinimization, "NoMinimization")
 	(MinimizationStrategy::SimpleMinimization, "SimpleMinimization")
-	(MinimizationStrategy::LinearMinimization, "LinearMinimization");
+	(MinimizationStrategy::LinearMinimization, "LinearMinimization")
+	(MinimizationStrategy::QuickXplainMinimization, "QuickXplainMinimization")
+	(MinimizationStrategy::UnsatCoreMinimization, "UnsatCoreMinimization");
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
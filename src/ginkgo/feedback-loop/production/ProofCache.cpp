@@ -0,0 +1,98 @@
+#include <ginkgo/feedback-loop/production/ProofCache.h>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ProofCache
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ProofCache::find(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod, size_t learnedConstraints,
+	ProofResult &proofResult) const
+{
+	const auto match = m_entries.find(key(hypothesis, proofMethod));
+
+	if (match == m_entries.end())
+		return false;
+
+	const auto &entry = match->second;
+
+	if (entry.proofResult != ProofResult::Proven && entry.learnedConstraints != learnedConstraints)
+		return false;
+
+	proofResult = entry.proofResult;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofCache::insert(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod, size_t learnedConstraints,
+	ProofResult proofResult)
+{
+	if (proofResult == ProofResult::Unknown)
+		return;
+
+	auto &entry = m_entries[key(hypothesis, proofMethod)];
+
+	// Never replace a proven result, which is valid for good
+	if (entry.proofResult == ProofResult::Proven)
+		return;
+
+	entry = {proofResult, learnedConstraints};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t ProofCache::size() const
+{
+	return m_entries.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string ProofCache::key(const GeneralizedConstraint &hypothesis, ProofMethod proofMethod)
+{
+	const auto &literals = hypothesis.originalConstraint()->literals();
+
+	std::vector<std::string> normalizedLiterals;
+	normalizedLiterals.reserve(literals.size());
+
+	std::transform(literals.cbegin(), literals.cend(), std::back_inserter(normalizedLiterals),
+		[&](const auto &literal)
+		{
+			std::stringstream normalizedLiteral;
+			literal.print(normalizedLiteral, Literal::OutputFormat::Generalized, hypothesis.offset());
+
+			return normalizedLiteral.str();
+		});
+
+	std::sort(normalizedLiterals.begin(), normalizedLiterals.end());
+
+	std::stringstream key;
+
+	std::for_each(normalizedLiterals.cbegin(), normalizedLiterals.cend(), [&](const auto &normalizedLiteral)
+	{
+		key << normalizedLiteral << ", ";
+	});
+
+	key << proofMethod;
+
+	return key.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -0,0 +1,334 @@
+#include <ginkgo/feedback-loop/production/ProofSession.h>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#include <boost/assert.hpp>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ProofSession
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string ProofSession::StepEncoding =
+	// Enable this time step on demand
+	"#external active(t).\n"
+	"time(t) :- active(t).\n"
+	// Perform actions
+	"1 {apply(A, t) : action(A)} 1 :- time(t).\n"
+	// Check preconditions
+	":- apply(A, t), demands(A, F, true), not holds(F, t - 1).\n"
+	":- apply(A, t), demands(A, F, false), holds(F, t - 1).\n"
+	// Apply effects
+	"holds(F, t) :- apply(A, t), adds(A, F), action(A).\n"
+	"del(F, t) :- apply(A, t), deletes(A, F), action(A).\n"
+	"holds(F, t) :- holds(F, t - 1), not del(F, t), time(t).\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofSession::ProofSession(ProofType proofType)
+:	m_proofType{proofType},
+	m_horizon{0},
+	m_groundedLearnedConstraints{0},
+	m_numberOfParts{0},
+	m_numberOfHypotheses{0},
+	m_batchGroundingTime{0.0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::groundProgram(const std::string &program)
+{
+	m_clingo.reset();
+
+	m_horizon = 0;
+	m_groundedLearnedConstraints = 0;
+	m_numberOfParts = 0;
+	m_numberOfHypotheses = 0;
+	m_groundedHypotheses.clear();
+	m_batchGroundingTime = 0.0;
+
+	try
+	{
+		m_clingo.add("base", {}, program + "time(0).\n");
+		m_clingo.ground("base");
+		m_clingo.add("step", {"t"}, StepEncoding);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "[Error] Could not ground proof session: " << e.what() << std::endl;
+		m_clingo.reset();
+		return;
+	}
+
+	if (!m_clingo.warnings().empty())
+		std::cout << "[Warn ] Warning while grounding: " << m_clingo.warnings() << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string toString(const GeneralizedConstraint &hypothesis)
+{
+	std::stringstream stream;
+	stream << hypothesis;
+
+	return stream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::groundHypotheses(const std::vector<GeneralizedConstraint> &hypotheses)
+{
+	if (!m_clingo.hasSession() || hypotheses.empty()
+		|| m_groundedHypotheses.find(toString(hypotheses.front())) != m_groundedHypotheses.end())
+	{
+		return;
+	}
+
+	// Hypotheses of the last batch that were not proven are not needed anymore
+	releaseGroundedHypotheses();
+
+	m_clingo.resetStatistics();
+
+	// The induction step needs one more time step than the degree of the hypothesis
+	const auto maxDegree = std::max_element(hypotheses.cbegin(), hypotheses.cend(),
+		[](const auto &a, const auto &b) {return a.degree() < b.degree();})->degree();
+	const auto horizon = maxDegree + (m_proofType == ProofType::InductionStepProof ? 1 : 0);
+
+	std::stringstream encoding;
+
+	std::for_each(hypotheses.cbegin(), hypotheses.cend(), [&](const auto &hypothesis)
+	{
+		const auto key = toString(hypothesis);
+
+		if (m_groundedHypotheses.find(key) != m_groundedHypotheses.end())
+			return;
+
+		encodeHypothesis(encoding, hypothesis, m_numberOfHypotheses);
+		m_groundedHypotheses.emplace(key, m_numberOfHypotheses);
+		m_numberOfHypotheses++;
+	});
+
+	const auto partName = "part_" + std::to_string(m_numberOfParts);
+	m_numberOfParts++;
+
+	try
+	{
+		extendHorizon(horizon);
+		m_clingo.add(partName, {}, encoding.str());
+		m_clingo.ground(partName);
+	}
+	catch (const std::exception &e)
+	{
+		// The hypotheses are grounded separately again when proving them
+		std::cerr << "[Error] Could not ground hypotheses: " << e.what() << std::endl;
+		m_groundedHypotheses.clear();
+		return;
+	}
+
+	m_batchGroundingTime = m_clingo.groundingTime();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult ProofSession::prove(const GeneralizedConstraint &hypothesis, const Constraints &learnedConstraints,
+	const std::chrono::milliseconds &timeout, EventHypothesisTested &event)
+{
+	event.proofResult = ProofResult::Unknown;
+
+	if (!m_clingo.hasSession())
+	{
+		std::cerr << "[Error] Proof session not initialized" << std::endl;
+		return ProofResult::Unknown;
+	}
+
+	m_clingo.resetStatistics();
+
+	// The induction step needs one more time step than the degree of the hypothesis
+	const auto horizon = hypothesis.degree() + (m_proofType == ProofType::InductionStepProof ? 1 : 0);
+	const auto groundedHypothesis = m_groundedHypotheses.find(toString(hypothesis));
+	const auto isGrounded = (groundedHypothesis != m_groundedHypotheses.end());
+	const auto hypothesisID = isGrounded ? groundedHypothesis->second : m_numberOfHypotheses;
+
+	if (isGrounded)
+		m_groundedHypotheses.erase(groundedHypothesis);
+
+	try
+	{
+		extendHorizon(horizon);
+		groundLearnedConstraints(learnedConstraints);
+
+		if (!isGrounded)
+			groundHypothesis(hypothesis);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "[Error] Could not ground hypothesis: " << e.what() << std::endl;
+		return ProofResult::Unknown;
+	}
+
+	if (!m_clingo.warnings().empty())
+		std::cout << "[Warn ] Warning while grounding: " << m_clingo.warnings() << std::endl;
+
+	const auto hypothesisAtom = "hypothesis(" + std::to_string(hypothesisID) + ")";
+
+	event.groundingTime = m_clingo.groundingTime() + m_batchGroundingTime;
+	m_batchGroundingTime = 0.0;
+
+	// Grounding cannot be interrupted in-process, so timeouts are only detected afterward
+	if (timeout != std::chrono::milliseconds(0)
+		&& std::chrono::duration<double>(event.groundingTime) > timeout)
+	{
+		m_clingo.releaseExternal(hypothesisAtom);
+		event.proofResult = ProofResult::GroundingTimeout;
+		return ProofResult::GroundingTimeout;
+	}
+
+	// Only consider the time steps required by this hypothesis
+	std::vector<ClingoSolver::Assumption> assumptions;
+	assumptions.reserve(m_horizon + 1);
+	assumptions.emplace_back(hypothesisAtom, true);
+
+	for (size_t t = 1; t <= m_horizon; t++)
+		assumptions.emplace_back("active(" + std::to_string(t) + ")", t <= horizon);
+
+	bool solvingTimeout = false;
+
+	const auto satisfiable = m_clingo.solve(assumptions, timeout, solvingTimeout);
+
+	// The hypothesis is never needed again, so let the solver simplify its rules away
+	m_clingo.releaseExternal(hypothesisAtom);
+
+	auto proofResult = ProofResult::Unknown;
+
+	if (solvingTimeout)
+		proofResult = ProofResult::SolvingTimeout;
+	else if (satisfiable == Satisfiability::Unsatisfiable)
+		proofResult = ProofResult::Proven;
+	else if (satisfiable == Satisfiability::Satisfiable)
+		proofResult = ProofResult::Unproven;
+
+	event.proofResult = proofResult;
+	event.claspJSONOutput = m_clingo.statistics();
+
+	return proofResult;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<std::string> &ProofSession::model() const
+{
+	return m_clingo.model();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::extendHorizon(size_t horizon)
+{
+	if (horizon <= m_horizon)
+		return;
+
+	for (auto t = m_horizon + 1; t <= horizon; t++)
+		m_clingo.ground("step", {static_cast<int>(t)});
+
+	m_horizon = horizon;
+
+	// Learned constraints have to be grounded again to cover the new time steps
+	m_groundedLearnedConstraints = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::groundLearnedConstraints(const Constraints &learnedConstraints)
+{
+	BOOST_ASSERT(m_groundedLearnedConstraints <= learnedConstraints.size());
+
+	if (m_groundedLearnedConstraints == learnedConstraints.size())
+		return;
+
+	std::stringstream encoding;
+
+	std::for_each(learnedConstraints.cbegin() + m_groundedLearnedConstraints, learnedConstraints.cend(),
+		[&](const auto &constraint)
+		{
+			GeneralizedConstraint(constraint).print(encoding);
+			encoding << std::endl;
+		});
+
+	const auto partName = "part_" + std::to_string(m_numberOfParts);
+	m_numberOfParts++;
+
+	m_clingo.add(partName, {}, encoding.str());
+	m_clingo.ground(partName);
+
+	m_groundedLearnedConstraints = learnedConstraints.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::groundHypothesis(const GeneralizedConstraint &hypothesis)
+{
+	const auto hypothesisID = m_numberOfHypotheses;
+	m_numberOfHypotheses++;
+
+	std::stringstream encoding;
+	encodeHypothesis(encoding, hypothesis, hypothesisID);
+
+	const auto partName = "part_" + std::to_string(m_numberOfParts);
+	m_numberOfParts++;
+
+	m_clingo.add(partName, {}, encoding.str());
+	m_clingo.ground(partName);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::encodeHypothesis(std::ostream &encoding, const GeneralizedConstraint &hypothesis, size_t hypothesisID) const
+{
+	encoding
+		<< "#external hypothesis(" << hypothesisID << ")." << std::endl
+		<< "hypothesisConstraint(" << hypothesisID << ", T) " << hypothesis << std::endl;
+
+	if (m_proofType == ProofType::InductionStepProof)
+	{
+		encoding
+			// Eliminate all states not complying with the constraint at t = 0
+			<< ":- hypothesis(" << hypothesisID << "), hypothesisConstraint(" << hypothesisID << ", 0)." << std::endl
+			// Eliminate all states complying with the constraint at t = 1
+			<< ":- hypothesis(" << hypothesisID << "), not hypothesisConstraint(" << hypothesisID << ", 1)." << std::endl;
+	}
+	else
+	{
+		encoding
+			// Eliminate all states complying with the constraint at t = 0
+			<< ":- hypothesis(" << hypothesisID << "), not hypothesisConstraint(" << hypothesisID << ", 0)." << std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProofSession::releaseGroundedHypotheses()
+{
+	std::for_each(m_groundedHypotheses.cbegin(), m_groundedHypotheses.cend(), [&](const auto &groundedHypothesis)
+	{
+		m_clingo.releaseExternal("hypothesis(" + std::to_string(groundedHypothesis.second) + ")");
+	});
+
+	m_groundedHypotheses.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
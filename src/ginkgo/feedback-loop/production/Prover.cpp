@@ -0,0 +1,288 @@
+#include <ginkgo/feedback-loop/production/Prover.h>
+
+#include <algorithm>
+#include <iostream>
+
+#include <boost/assert.hpp>
+
+#include <json/json.h>
+
+#include <ginkgo/solving/ClaspOutputParsing.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Prover
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static AsyncProcess::Configuration claspConfiguration(const Environment &environment, bool keepModels)
+{
+	auto configuration = environment.claspConfiguration();
+
+	if (!keepModels)
+		return configuration;
+
+	auto &arguments = configuration.arguments;
+
+	// Print the model instead of only the satisfiability
+	arguments.erase(std::remove_if(arguments.begin(), arguments.end(),
+		[](const auto &argument)
+		{
+			return argument.compare(0, 7, "--quiet") == 0;
+		}), arguments.end());
+
+	arguments.push_back("--quiet=1");
+
+	return configuration;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Prover::Prover(const Environment &environment, SolverBackend solverBackend, bool pipelineProcesses, bool keepModels)
+:	m_solverBackend{solverBackend},
+	m_pipelineProcesses{pipelineProcesses},
+	m_cancelled{false},
+	m_gringo(environment.gringoConfiguration()),
+	m_clasp(claspConfiguration(environment, keepModels))
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult Prover::prove(const Encoding &proofEncoding, const std::chrono::milliseconds &timeout,
+	EventHypothesisTested &event)
+{
+	return prove(proofEncoding, {}, timeout, event);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult Prover::prove(const Encoding &proofEncoding, const std::vector<ClingoSolver::Assumption> &assumptions,
+	const std::chrono::milliseconds &timeout, EventHypothesisTested &event)
+{
+	switch (m_solverBackend)
+	{
+		case SolverBackend::Process:
+			if (!assumptions.empty())
+			{
+				std::cerr << "[Error] Assumptions are not supported with the process backend" << std::endl;
+				event.proofResult = ProofResult::Unknown;
+				return ProofResult::Unknown;
+			}
+
+			return proveWithProcesses(proofEncoding, nullptr, timeout, event);
+		case SolverBackend::Clingo:
+		// Proofs outside of proof sessions are solved from scratch
+		case SolverBackend::ClingoIncremental:
+			return proveWithClingo(proofEncoding, assumptions, timeout, event);
+		default:
+			std::cerr << "[Error] Unknown solver backend" << std::endl;
+			event.proofResult = ProofResult::Unknown;
+			return ProofResult::Unknown;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult Prover::prove(const GroundProgram &groundProgram, const Encoding &proofEncoding,
+	const std::chrono::milliseconds &timeout, EventHypothesisTested &event)
+{
+	if (m_solverBackend != SolverBackend::Process)
+	{
+		std::cerr << "[Error] Ground programs are only supported with the process backend" << std::endl;
+		event.proofResult = ProofResult::Unknown;
+		return ProofResult::Unknown;
+	}
+
+	return proveWithProcesses(proofEncoding, &groundProgram, timeout, event);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult Prover::proveWithProcesses(const Encoding &proofEncoding, const GroundProgram *groundProgram,
+	const std::chrono::milliseconds &timeout, EventHypothesisTested &event)
+{
+	bool groundingTimeout = false;
+	bool solvingTimeout = false;
+
+	m_model.clear();
+
+	if (isCancelled())
+	{
+		event.proofResult = ProofResult::Unknown;
+		return ProofResult::Unknown;
+	}
+
+	auto satisfiable = Satisfiability::Unknown;
+	double groundingTime = 0.0;
+	bool linkFailed = false;
+
+	if (m_pipelineProcesses && !groundProgram)
+	{
+		AsyncProcess::runPipeline(m_gringo, m_clasp, proofEncoding, timeout, groundingTimeout, timeout,
+			solvingTimeout, groundingTime);
+
+		if (m_gringo.stderr() && parseForWarnings(*m_gringo.stderr()))
+			std::cout << "[Warn ] Warning while grounding: " << m_gringo.stderr()->rdbuf() << std::endl;
+	}
+	else
+	{
+		const auto groundingStartTime = std::chrono::high_resolution_clock::now();
+		m_gringo.run(proofEncoding, timeout, groundingTimeout);
+		m_gringo.join();
+		const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+
+		groundingTime = std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count();
+
+		// A cancelled grounder produces incomplete output, which must not be solved
+		if (!groundingTimeout && !isCancelled())
+		{
+			BOOST_ASSERT(m_gringo.stdout());
+
+			if (m_gringo.stderr() && parseForWarnings(*m_gringo.stderr()))
+				std::cout << "[Warn ] Warning while grounding: " << m_gringo.stderr()->rdbuf() << std::endl;
+
+			if (!groundProgram)
+			{
+				m_clasp.run(*m_gringo.stdout(), timeout, solvingTimeout);
+				m_clasp.join();
+			}
+			else
+			{
+				Encoding linkedProgram;
+				linkFailed = !groundProgram->append(m_gringo.stdout()->str(), linkedProgram);
+
+				// Linking is accounted to the grounding time
+				groundingTime += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - groundingFinishedTime).count();
+
+				if (linkFailed)
+					std::cerr << "[Error] Could not append proof to ground program" << std::endl;
+				else
+				{
+					m_clasp.run(linkedProgram, timeout, solvingTimeout);
+					m_clasp.join();
+				}
+			}
+		}
+	}
+
+	if (!groundingTimeout && !linkFailed && !isCancelled())
+	{
+		BOOST_ASSERT(m_clasp.stdout());
+		satisfiable = parseForSatisfiability(*m_clasp.stdout());
+		*m_clasp.stdout() >> event.claspJSONOutput;
+
+		// Models are kept as counterexamples, but would bloat the recorded events
+		if (parseForModel(event.claspJSONOutput, m_model))
+			event.claspJSONOutput["Call"][0].removeMember("Witnesses");
+
+		// clasp runs alongside gringo in a pipeline, so its total time includes the grounding time
+		if (m_pipelineProcesses && !groundProgram)
+		{
+			auto &totalTime = event.claspJSONOutput["Time"]["Total"];
+			totalTime = std::max(0.0, totalTime.asDouble() - groundingTime);
+		}
+	}
+
+	auto proofResult = ProofResult::Unknown;
+
+	if (isCancelled())
+		proofResult = ProofResult::Unknown;
+	else if (groundingTimeout)
+		proofResult = ProofResult::GroundingTimeout;
+	else if (solvingTimeout)
+		proofResult = ProofResult::SolvingTimeout;
+	else if (satisfiable == Satisfiability::Unsatisfiable)
+		proofResult = ProofResult::Proven;
+	else if (satisfiable == Satisfiability::Satisfiable)
+		proofResult = ProofResult::Unproven;
+
+	event.proofResult = proofResult;
+	event.groundingTime = groundingTime;
+
+	return proofResult;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProofResult Prover::proveWithClingo(const Encoding &proofEncoding, const std::vector<ClingoSolver::Assumption> &assumptions,
+	const std::chrono::milliseconds &timeout, EventHypothesisTested &event)
+{
+	bool groundingTimeout = false;
+	bool solvingTimeout = false;
+
+	const auto satisfiable = m_clingo.solve(proofEncoding, assumptions, timeout, groundingTimeout, solvingTimeout);
+
+	if (!m_clingo.warnings().empty())
+		std::cout << "[Warn ] Warning while grounding: " << m_clingo.warnings() << std::endl;
+
+	auto proofResult = ProofResult::Unknown;
+
+	if (groundingTimeout)
+		proofResult = ProofResult::GroundingTimeout;
+	else if (solvingTimeout)
+		proofResult = ProofResult::SolvingTimeout;
+	else if (satisfiable == Satisfiability::Unsatisfiable)
+		proofResult = ProofResult::Proven;
+	else if (satisfiable == Satisfiability::Satisfiable)
+		proofResult = ProofResult::Unproven;
+
+	event.proofResult = proofResult;
+	event.groundingTime = m_clingo.groundingTime();
+	event.claspJSONOutput = m_clingo.statistics();
+
+	return proofResult;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<std::string> &Prover::core() const
+{
+	return m_clingo.core();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<std::string> &Prover::model() const
+{
+	if (m_solverBackend == SolverBackend::Process)
+		return m_model;
+
+	return m_clingo.model();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Prover::cancel()
+{
+	std::lock_guard<std::mutex> lock(m_cancelMutex);
+
+	m_cancelled = true;
+
+	// Processes being started concurrently are killed right away or not started at all
+	m_gringo.cancel();
+	m_clasp.cancel();
+	m_clingo.interrupt();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Prover::isCancelled()
+{
+	std::lock_guard<std::mutex> lock(m_cancelMutex);
+
+	return m_cancelled;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
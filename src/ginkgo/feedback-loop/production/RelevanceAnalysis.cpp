@@ -0,0 +1,277 @@
+#include <ginkgo/feedback-loop/production/RelevanceAnalysis.h>
+
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <ginkgo/solving/ClingoSolver.h>
+#include <ginkgo/solving/Literal.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// RelevanceAnalysis
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string toString(const Literal &literal)
+{
+	std::stringstream stream;
+	stream << literal;
+
+	return stream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool RelevanceAnalysis::computeFacts(const std::string &program, std::vector<std::string> &atoms)
+{
+	// Shown atoms would hide the rest of the model, and states must be given by the facts alone
+	if (program.find("#show") != std::string::npos || program.find("holds(") != std::string::npos
+		|| program.find("apply(") != std::string::npos)
+	{
+		return false;
+	}
+
+	return ClingoSolver::computeUniqueModel(program, std::chrono::milliseconds(0), atoms);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+RelevanceAnalysis::RelevanceAnalysis(const std::vector<std::string> &atoms, SymbolTable &symbolTable)
+:	m_facts(atoms),
+	m_isRemoved(atoms.size(), false)
+{
+	struct Action
+	{
+		std::vector<std::string> positiveDemands;
+		std::vector<std::string> negativeDemands;
+		std::vector<std::string> effects;
+	};
+
+	Literals facts;
+	facts.reserve(atoms.size());
+
+	std::for_each(atoms.cbegin(), atoms.cend(), [&](const auto &atom)
+	{
+		size_t position = 0;
+		facts.emplace_back(atom, position, symbolTable);
+	});
+
+	// Only declared actions are ever applied
+	std::unordered_map<std::string, Action> actions;
+	std::set<std::string> fluents;
+	std::unordered_set<std::string> initialFluents;
+
+	for (const auto &fact : facts)
+		if (*fact.name() == "action" && fact.arguments().size() == 1)
+			actions.emplace(toString(fact.arguments()[0]), Action());
+
+	for (const auto &fact : facts)
+	{
+		const auto &name = *fact.name();
+		const auto &arguments = fact.arguments();
+
+		if ((name == "init" || name == "fluent") && arguments.size() == 1)
+		{
+			fluents.insert(toString(arguments[0]));
+
+			if (name == "init")
+				initialFluents.insert(toString(arguments[0]));
+
+			continue;
+		}
+
+		const auto isDemand = (name == "demands" && arguments.size() == 3);
+		const auto isEffect = ((name == "adds" || name == "deletes") && arguments.size() == 2);
+
+		if (!isDemand && !isEffect)
+			continue;
+
+		const auto match = actions.find(toString(arguments[0]));
+
+		if (match == actions.end())
+			continue;
+
+		const auto fluent = toString(arguments[1]);
+		fluents.insert(fluent);
+
+		if (isDemand && *arguments[2].name() == "true")
+			match->second.positiveDemands.push_back(fluent);
+		else if (isDemand)
+			match->second.negativeDemands.push_back(fluent);
+		else
+			match->second.effects.push_back(fluent);
+	}
+
+	std::unordered_set<std::string> reachableFluents;
+	std::unordered_set<std::string> reachableActions;
+	std::unordered_set<std::string> changedFluents;
+	std::unordered_set<std::string> inapplicableActions;
+
+	// Static fluents hold if and only if they hold initially
+	const auto isStatic = [&](const std::string &fluent)
+	{
+		return changedFluents.count(fluent) == 0;
+	};
+
+	// Actions with negative demands on initially holding static fluents are never applicable, and
+	// removing them may turn further fluents static
+	for (bool removedActions = true; removedActions;)
+	{
+		reachableFluents = initialFluents;
+		reachableActions.clear();
+		changedFluents.clear();
+
+		// Relaxed reachability, ignoring deletes and negative demands
+		for (bool changed = true; changed;)
+		{
+			changed = false;
+
+			for (const auto &action : actions)
+			{
+				if (reachableActions.count(action.first) > 0 || inapplicableActions.count(action.first) > 0)
+					continue;
+
+				const auto isEnabled = std::all_of(action.second.positiveDemands.cbegin(), action.second.positiveDemands.cend(),
+					[&](const auto &fluent) {return reachableFluents.count(fluent) > 0;});
+
+				if (!isEnabled)
+					continue;
+
+				reachableActions.insert(action.first);
+				changed = true;
+
+				for (const auto &fluent : action.second.effects)
+					reachableFluents.insert(fluent);
+			}
+		}
+
+		for (const auto &action : reachableActions)
+			for (const auto &fluent : actions[action].effects)
+				changedFluents.insert(fluent);
+
+		removedActions = false;
+
+		for (const auto &action : reachableActions)
+		{
+			const auto &negativeDemands = actions[action].negativeDemands;
+
+			const auto isApplicable = std::none_of(negativeDemands.cbegin(), negativeDemands.cend(),
+				[&](const auto &fluent) {return isStatic(fluent) && initialFluents.count(fluent) > 0;});
+
+			if (isApplicable)
+				continue;
+
+			inapplicableActions.insert(action);
+			removedActions = true;
+		}
+	}
+
+	m_numberOfFluents = fluents.size();
+	m_numberOfReachableFluents = reachableFluents.size();
+	m_numberOfStaticFluents = std::count_if(fluents.cbegin(), fluents.cend(), isStatic);
+	m_numberOfActions = actions.size();
+	m_numberOfReachableActions = reachableActions.size();
+
+	for (size_t i = 0; i < facts.size(); i++)
+	{
+		const auto &name = *facts[i].name();
+		const auto &arguments = facts[i].arguments();
+
+		if (name == "fluent" && arguments.size() == 1)
+			m_isRemoved[i] = (reachableFluents.count(toString(arguments[0])) == 0);
+		else if (name == "action" && arguments.size() == 1)
+			m_isRemoved[i] = (reachableActions.count(toString(arguments[0])) == 0);
+		else if ((name == "adds" || name == "deletes") && arguments.size() == 2)
+			m_isRemoved[i] = (reachableActions.count(toString(arguments[0])) == 0);
+		else if (name == "demands" && arguments.size() == 3)
+		{
+			const auto fluent = toString(arguments[1]);
+			const auto sign = (*arguments[2].name() == "true");
+
+			// Demands on static fluents are always met by reachable actions
+			const auto isAlwaysMet = isStatic(fluent)
+				&& (sign == (initialFluents.count(fluent) > 0) || reachableFluents.count(fluent) == 0);
+
+			m_isRemoved[i] = (reachableActions.count(toString(arguments[0])) == 0 || isAlwaysMet);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string RelevanceAnalysis::reducedProgram() const
+{
+	std::stringstream program;
+
+	for (size_t i = 0; i < m_facts.size(); i++)
+		if (!m_isRemoved[i])
+			program << m_facts[i] << "." << std::endl;
+
+	return program.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfFacts() const
+{
+	return m_facts.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfReducedFacts() const
+{
+	return std::count(m_isRemoved.cbegin(), m_isRemoved.cend(), false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfFluents() const
+{
+	return m_numberOfFluents;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfReachableFluents() const
+{
+	return m_numberOfReachableFluents;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfStaticFluents() const
+{
+	return m_numberOfStaticFluents;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfActions() const
+{
+	return m_numberOfActions;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t RelevanceAnalysis::numberOfReachableActions() const
+{
+	return m_numberOfReachableActions;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
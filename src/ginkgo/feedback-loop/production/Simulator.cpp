@@ -0,0 +1,583 @@
+#include <ginkgo/feedback-loop/production/Simulator.h>
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#include <boost/assert.hpp>
+
+#include <ginkgo/solving/Literal.h>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Simulator
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string Simulator::FactsEncoding =
+	"#show fluent/1.\n"
+	"#show init/1.\n"
+	"#show action/1.\n"
+	"#show demands/3.\n"
+	"#show adds/2.\n"
+	"#show deletes/2.\n";
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string toString(const Literal &literal)
+{
+	std::stringstream stream;
+	stream << literal;
+
+	return stream.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Simulator::Simulator(const std::vector<std::string> &atoms, SymbolTable &symbolTable)
+{
+	Literals facts;
+	facts.reserve(atoms.size());
+
+	std::for_each(atoms.cbegin(), atoms.cend(), [&](const auto &atom)
+	{
+		size_t position = 0;
+		facts.emplace_back(atom, position, symbolTable);
+	});
+
+	// Only declared actions are ever applied
+	std::for_each(facts.cbegin(), facts.cend(), [&](const auto &fact)
+	{
+		if (*fact.name() == "action" && fact.arguments().size() == 1)
+			action(toString(fact.arguments()[0]));
+	});
+
+	std::vector<size_t> initialFluents;
+	std::vector<size_t> declaredFluents;
+
+	std::for_each(facts.cbegin(), facts.cend(), [&](const auto &fact)
+	{
+		const auto &name = *fact.name();
+		const auto &arguments = fact.arguments();
+
+		if (name == "init" && arguments.size() == 1)
+		{
+			initialFluents.push_back(fluent(toString(arguments[0])));
+			return;
+		}
+
+		if (name == "fluent" && arguments.size() == 1)
+		{
+			declaredFluents.push_back(fluent(toString(arguments[0])));
+			return;
+		}
+
+		const auto isDemand = (name == "demands" && arguments.size() == 3);
+		const auto isEffect = ((name == "adds" || name == "deletes") && arguments.size() == 2);
+
+		if (!isDemand && !isEffect)
+			return;
+
+		const auto match = m_actionIndices.find(toString(arguments[0]));
+
+		if (match == m_actionIndices.end())
+			return;
+
+		auto &action = m_actions[match->second];
+		const auto fluentIndex = fluent(toString(arguments[1]));
+
+		if (isDemand && *arguments[2].name() == "true")
+			action.positiveDemands.push_back(fluentIndex);
+		else if (isDemand)
+			action.negativeDemands.push_back(fluentIndex);
+		else if (name == "adds")
+			action.adds.push_back(fluentIndex);
+		else
+			action.deletes.push_back(fluentIndex);
+	});
+
+	m_initialState.resize(m_fluents.size(), false);
+	m_declaredFluents.resize(m_fluents.size(), false);
+
+	for (const auto fluent : initialFluents)
+		m_initialState[fluent] = true;
+
+	for (const auto fluent : declaredFluents)
+		m_declaredFluents[fluent] = true;
+
+	// Build the fluent closure using forward chaining, just like in the proof encodings
+	m_fluentClosure = m_initialState;
+
+	for (bool changed = true; changed;)
+	{
+		changed = false;
+
+		for (const auto &action : m_actions)
+		{
+			const auto isEnabled = std::all_of(action.positiveDemands.cbegin(), action.positiveDemands.cend(),
+				[&](const auto fluent)
+				{
+					return m_fluentClosure[fluent];
+				});
+
+			if (!isEnabled)
+				continue;
+
+			for (const auto fluent : action.adds)
+			{
+				changed |= !m_fluentClosure[fluent];
+				m_fluentClosure[fluent] = true;
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Simulator::numberOfFluents() const
+{
+	return m_fluents.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Simulator::numberOfActions() const
+{
+	return m_actions.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Counterexample> Simulator::exploreBreadthFirst(size_t horizon, size_t maxTraces) const
+{
+	std::vector<Counterexample> counterexamples;
+
+	if (maxTraces == 0)
+		return counterexamples;
+
+	std::vector<Trace> traces(1);
+	traces.front().states.push_back(m_initialState);
+
+	for (size_t t = 1; t <= horizon && !traces.empty(); t++)
+	{
+		std::vector<Trace> extendedTraces;
+
+		for (const auto &trace : traces)
+		{
+			const auto actions = applicableActions(trace.states.back());
+
+			// Dead ends are kept as shorter traces
+			if (actions.empty())
+				counterexamples.push_back(counterexample(trace, true));
+
+			for (const auto action : actions)
+			{
+				if (extendedTraces.size() >= maxTraces)
+					break;
+
+				auto extendedTrace = trace;
+				extendedTrace.states.push_back(apply(m_actions[action], trace.states.back()));
+				extendedTrace.actions.push_back(action);
+				extendedTraces.push_back(std::move(extendedTrace));
+			}
+		}
+
+		traces = std::move(extendedTraces);
+	}
+
+	std::for_each(traces.cbegin(), traces.cend(), [&](const auto &trace)
+	{
+		counterexamples.push_back(counterexample(trace, true));
+	});
+
+	return counterexamples;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Counterexample> Simulator::walkFromInitialState(size_t horizon, size_t walks, std::mt19937 &generator) const
+{
+	std::vector<Counterexample> counterexamples;
+	counterexamples.reserve(walks);
+
+	for (size_t i = 0; i < walks; i++)
+	{
+		Trace trace;
+		trace.states.push_back(m_initialState);
+
+		walk(trace, horizon, generator);
+
+		counterexamples.push_back(counterexample(trace, true));
+	}
+
+	return counterexamples;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<Counterexample> Simulator::walkFromFluentClosure(size_t horizon, size_t walks, std::mt19937 &generator) const
+{
+	std::vector<Counterexample> counterexamples;
+	counterexamples.reserve(walks);
+
+	std::bernoulli_distribution isSet(0.5);
+
+	for (size_t i = 0; i < walks; i++)
+	{
+		State state(m_fluents.size(), false);
+
+		for (size_t fluent = 0; fluent < m_fluents.size(); fluent++)
+			state[fluent] = m_fluentClosure[fluent] && isSet(generator);
+
+		Trace trace;
+		trace.states.push_back(std::move(state));
+
+		walk(trace, horizon, generator);
+
+		counterexamples.push_back(counterexample(trace, false));
+	}
+
+	return counterexamples;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Simulator::checkStateWiseProof(const Constraint &hypothesis, const Constraints &learnedConstraints,
+	FluentClosureUsage fluentClosureUsage, size_t maxStates, ProofResult &proofResult) const
+{
+	Conditions hypothesisConditions;
+	bool canBeViolated;
+
+	if (!makeConditions(hypothesis, hypothesisConditions, canBeViolated) || hypothesisConditions.degree > 1)
+		return false;
+
+	if (!canBeViolated)
+	{
+		proofResult = ProofResult::Proven;
+		return true;
+	}
+
+	// Learned constraints only apply if they fit into the time steps of the proof
+	std::vector<Conditions> learnedConditions;
+
+	for (auto learnedConstraint = learnedConstraints.cbegin(); learnedConstraint != learnedConstraints.cend(); learnedConstraint++)
+	{
+		Conditions conditions;
+
+		if (!makeConditions(**learnedConstraint, conditions, canBeViolated))
+			return false;
+
+		if (canBeViolated && conditions.degree <= hypothesisConditions.degree)
+			learnedConditions.push_back(std::move(conditions));
+	}
+
+	// All other fluents are unconstrained, so they are only set to fulfill demands of actions
+	std::vector<bool> isRelevant(m_fluents.size(), false);
+
+	const auto markRelevant = [&](const Conditions &conditions)
+	{
+		for (const auto &condition : conditions.conditions)
+			if (condition.type != Condition::Type::Apply)
+				isRelevant[condition.index] = true;
+	};
+
+	markRelevant(hypothesisConditions);
+	std::for_each(learnedConditions.cbegin(), learnedConditions.cend(), markRelevant);
+
+	const auto &startFluents = (fluentClosureUsage == FluentClosureUsage::UseFluentClosure)
+		? m_fluentClosure
+		: m_declaredFluents;
+
+	std::vector<size_t> freeFluents;
+
+	for (size_t fluent = 0; fluent < m_fluents.size(); fluent++)
+		if (isRelevant[fluent] && startFluents[fluent])
+			freeFluents.push_back(fluent);
+
+	const auto transitions = (hypothesisConditions.degree == 0) ? size_t(1) : std::max<size_t>(1, m_actions.size());
+
+	if (freeFluents.size() >= 32 || (size_t(1) << freeFluents.size()) > maxStates / transitions)
+		return false;
+
+	const auto complies = [&](const Trace &trace)
+	{
+		return std::none_of(learnedConditions.cbegin(), learnedConditions.cend(), [&](const auto &conditions)
+		{
+			for (size_t t = 0; t + conditions.degree < trace.states.size(); t++)
+				if (isViolated(conditions, trace, t))
+					return true;
+
+			return false;
+		});
+	};
+
+	for (size_t mask = 0; mask < (size_t(1) << freeFluents.size()); mask++)
+	{
+		State startState(m_fluents.size(), false);
+
+		for (size_t i = 0; i < freeFluents.size(); i++)
+			startState[freeFluents[i]] = (mask >> i) & 1;
+
+		Trace trace;
+		trace.states.push_back(startState);
+
+		if (hypothesisConditions.degree == 0)
+		{
+			if (complies(trace) && isViolated(hypothesisConditions, trace, 0))
+			{
+				proofResult = ProofResult::Unproven;
+				return true;
+			}
+
+			continue;
+		}
+
+		for (size_t i = 0; i < m_actions.size(); i++)
+		{
+			const auto &action = m_actions[i];
+			auto state = startState;
+
+			// Fulfill the positive demands on fluents that are not constrained otherwise
+			for (const auto fluent : action.positiveDemands)
+				if (!isRelevant[fluent] && startFluents[fluent])
+					state[fluent] = true;
+
+			if (!isApplicable(action, state))
+				continue;
+
+			trace.states = {state, apply(action, state)};
+			trace.actions = {i};
+
+			if (complies(trace) && isViolated(hypothesisConditions, trace, 0))
+			{
+				proofResult = ProofResult::Unproven;
+				return true;
+			}
+		}
+	}
+
+	proofResult = ProofResult::Proven;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Simulator::fluent(const std::string &name)
+{
+	const auto match = m_fluentIndices.find(name);
+
+	if (match != m_fluentIndices.end())
+		return match->second;
+
+	m_fluents.push_back(name);
+	m_fluentIndices.emplace(name, m_fluents.size() - 1);
+
+	return m_fluents.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Simulator::action(const std::string &name)
+{
+	const auto match = m_actionIndices.find(name);
+
+	if (match != m_actionIndices.end())
+		return match->second;
+
+	m_actions.push_back({name, {}, {}, {}, {}});
+	m_actionIndices.emplace(name, m_actions.size() - 1);
+
+	return m_actions.size() - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Simulator::isApplicable(const Action &action, const State &state) const
+{
+	return std::all_of(action.positiveDemands.cbegin(), action.positiveDemands.cend(),
+			[&](const auto fluent) {return state[fluent];})
+		&& std::none_of(action.negativeDemands.cbegin(), action.negativeDemands.cend(),
+			[&](const auto fluent) {return state[fluent];});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Simulator::State Simulator::apply(const Action &action, const State &state) const
+{
+	BOOST_ASSERT(isApplicable(action, state));
+
+	auto result = state;
+
+	for (const auto fluent : action.deletes)
+		result[fluent] = false;
+
+	for (const auto fluent : action.adds)
+		result[fluent] = true;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<size_t> Simulator::applicableActions(const State &state) const
+{
+	std::vector<size_t> actions;
+
+	for (size_t i = 0; i < m_actions.size(); i++)
+		if (isApplicable(m_actions[i], state))
+			actions.push_back(i);
+
+	return actions;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Simulator::walk(Trace &trace, size_t horizon, std::mt19937 &generator) const
+{
+	BOOST_ASSERT(!trace.states.empty());
+
+	while (trace.actions.size() < horizon)
+	{
+		const auto actions = applicableActions(trace.states.back());
+
+		if (actions.empty())
+			break;
+
+		std::uniform_int_distribution<size_t> distribution(0, actions.size() - 1);
+		const auto action = actions[distribution(generator)];
+
+		trace.states.push_back(apply(m_actions[action], trace.states.back()));
+		trace.actions.push_back(action);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Counterexample Simulator::counterexample(const Trace &trace, bool startsInInitialState) const
+{
+	BOOST_ASSERT(trace.states.size() == trace.actions.size() + 1);
+
+	Counterexample counterexample = {startsInInitialState, trace.actions.size(), {}};
+
+	for (size_t t = 0; t < trace.states.size(); t++)
+	{
+		const auto time = std::to_string(t);
+
+		for (size_t fluent = 0; fluent < m_fluents.size(); fluent++)
+			if (trace.states[t][fluent])
+				counterexample.atoms.push_back("holds(" + m_fluents[fluent] + ", " + time + ")");
+
+		if (t == 0)
+			continue;
+
+		const auto &action = m_actions[trace.actions[t - 1]];
+
+		counterexample.atoms.push_back("apply(" + action.name + ", " + time + ")");
+
+		for (const auto fluent : action.deletes)
+			counterexample.atoms.push_back("del(" + m_fluents[fluent] + ", " + time + ")");
+	}
+
+	return counterexample;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Simulator::makeConditions(const Constraint &constraint, Conditions &conditions, bool &canBeViolated) const
+{
+	const auto &literals = constraint.literals();
+
+	if (literals.empty())
+		return false;
+
+	const auto timeRange = constraint.timeRange();
+	const auto &timeMin = std::get<0>(timeRange);
+	const auto &timeMax = std::get<1>(timeRange);
+
+	conditions.degree = timeMax - timeMin;
+	conditions.conditions.clear();
+	canBeViolated = true;
+
+	for (const auto &literal : literals)
+	{
+		const auto &name = *literal.name();
+
+		if (!literal.hasTimeArgument() || literal.arguments().size() != 1
+			|| (name != "holds" && name != "apply" && name != "del"))
+		{
+			return false;
+		}
+
+		const auto argument = toString(literal.arguments()[0]);
+		const auto &indices = (name == "apply") ? m_actionIndices : m_fluentIndices;
+		const auto match = indices.find(argument);
+
+		// Unknown fluents and actions never hold
+		if (match == indices.end())
+		{
+			canBeViolated &= !literal.sign();
+			continue;
+		}
+
+		Condition condition;
+		condition.type = (name == "holds") ? Condition::Type::Holds
+			: (name == "apply") ? Condition::Type::Apply : Condition::Type::Deleted;
+		condition.time = literal.timeArgument() - timeMin;
+		condition.sign = literal.sign();
+		condition.index = match->second;
+
+		conditions.conditions.push_back(condition);
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool Simulator::isViolated(const Conditions &conditions, const Trace &trace, size_t time) const
+{
+	BOOST_ASSERT(time + conditions.degree < trace.states.size());
+
+	return std::all_of(conditions.conditions.cbegin(), conditions.conditions.cend(), [&](const auto &condition)
+	{
+		const auto t = time + condition.time;
+		bool holds = false;
+
+		switch (condition.type)
+		{
+			case Condition::Type::Holds:
+				holds = trace.states[t][condition.index];
+				break;
+			case Condition::Type::Apply:
+				holds = (t > 0 && trace.actions[t - 1] == condition.index);
+				break;
+			case Condition::Type::Deleted:
+			{
+				if (t == 0)
+				{
+					holds = false;
+					break;
+				}
+
+				const auto &deletes = m_actions[trace.actions[t - 1]].deletes;
+				holds = std::find(deletes.cbegin(), deletes.cend(), condition.index) != deletes.cend();
+				break;
+			}
+		}
+
+		return holds == condition.sign;
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
@@ -0,0 +1,59 @@
+#include <ginkgo/feedback-loop/production/SolverBackend.h>
+
+#include <iostream>
+#include <boost/bimap.hpp>
+#include <boost/assign.hpp>
+
+namespace ginkgo
+{
+namespace feedbackLoop
+{
+namespace production
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// SolverBackend
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using SolverBackendNames = boost::bimap<SolverBackend, std::string>;
+static SolverBackendNames solverBackendNames = boost::assign::list_of<SolverBackendNames::relation>
+	(SolverBackend::Process, "Process")
+	(SolverBackend::Clingo, "Clingo")
+	(SolverBackend::ClingoIncremental, "ClingoIncremental");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::ostream &operator<<(std::ostream &ostream, const SolverBackend &solverBackend)
+{
+	const auto match = solverBackendNames.left.find(solverBackend);
+
+	if (match == solverBackendNames.left.end())
+		return (ostream << "Unknown");
+
+	return (ostream << (*match).second);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::istream &operator>>(std::istream &istream, SolverBackend &solverBackend)
+{
+	std::string solverBackendName;
+	istream >> solverBackendName;
+
+	const auto match = solverBackendNames.right.find(solverBackendName);
+
+	if (match == solverBackendNames.right.end())
+		solverBackend = SolverBackend::Unknown;
+	else
+		solverBackend = (*match).second;
+
+	return istream;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
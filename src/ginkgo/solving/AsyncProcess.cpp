@@ -1,5 +1,6 @@
 #include <ginkgo/solving/AsyncProcess.h>
 
+#include <csignal>
 #include <cstdio>
 #include <unistd.h>
 #include <fcntl.h>
@@ -10,12 +11,16 @@
 #include <algorithm>
 #include <cstring>
 #include <cerrno>
+#include <climits>
+#include <sys/uio.h>
 #include <sys/wait.h>
 #include <sys/epoll.h>
 
 #include <boost/filesystem.hpp>
 #include <boost/assert.hpp>
 
+#include <ginkgo/utils/Utils.h>
+
 namespace ginkgo
 {
 
@@ -27,8 +32,19 @@ namespace ginkgo
 
 AsyncProcess::AsyncProcess(Configuration configuration)
 :	m_configuration(configuration),
+	m_inPipe{{-1, -1}},
+	m_outPipe{{-1, -1}},
+	m_stdinFileDescriptor{-1},
+	m_stdoutFileDescriptor{-1},
 	m_childPID{0},
-	m_exitCode{-1}
+	m_exitCode{-1},
+	m_stdinRegistration{-1, 0},
+	m_stdoutRegistration{-1, 0},
+	m_stderrRegistration{-1, 0},
+	m_openFileDescriptors{0},
+	m_cancelled{false},
+	m_isStarted{false},
+	m_isFinished{false}
 {
 }
 
@@ -100,6 +116,20 @@ void AsyncProcess::clearStderr()
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+LineQueue &AsyncProcess::stdoutLines()
+{
+	return m_stdout.lines;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LineQueue &AsyncProcess::stderrLines()
+{
+	return m_stderr.lines;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool AsyncProcess::waitForEvent()
 {
 	m_eventSemaphore.wait();
@@ -120,17 +150,57 @@ bool AsyncProcess::waitForEvent(const std::chrono::milliseconds &relativeTime, s
 
 void AsyncProcess::run(std::stringstream &stdin, bool splitStdoutLines, bool splitStderrLines)
 {
-	m_childPID = 0;
-	m_exitCode = -1;
-	m_eventSemaphore.reset();
+	struct Chunk
+	{
+		std::vector<std::stringstream::char_type> buffer;
+		size_t begin;
+		size_t end;
+	};
 
-	m_stdout.splitLines = splitStdoutLines;
-	m_stderr.splitLines = splitStderrLines;
+	auto chunk = std::make_shared<Chunk>();
+	chunk->buffer.resize(m_configuration.bufferSize);
+	chunk->begin = 0;
+	chunk->end = 0;
 
-	m_thread = std::make_unique<std::thread>([this, &stdin]()
+	const auto writeStdin = [&stdin, chunk](int fileDescriptor)
 	{
-		runThread(stdin);
-	});
+		if (chunk->begin == chunk->end)
+		{
+			if (!stdin.good())
+			{
+				stdin.str(std::string());
+				// Clear fail flags from stdin
+				stdin.clear();
+				return false;
+			}
+
+			stdin.read(chunk->buffer.data(), chunk->buffer.size());
+			chunk->begin = 0;
+			chunk->end = stdin.gcount();
+		}
+
+		const auto written = write(fileDescriptor, chunk->buffer.data() + chunk->begin, chunk->end - chunk->begin);
+
+		if (written < 0)
+		{
+			if (errno == EAGAIN || errno == EINTR)
+				return true;
+
+			// Killed processes stop reading their input
+			if (errno != EPIPE)
+				std::cerr << "[Error] Couldn't write entire buffer" << std::endl;
+
+			stdin.str(std::string());
+			stdin.clear();
+			return false;
+		}
+
+		chunk->begin += written;
+
+		return true;
+	};
+
+	start(writeStdin, splitStdoutLines, splitStderrLines);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,46 +208,174 @@ void AsyncProcess::run(std::stringstream &stdin, bool splitStdoutLines, bool spl
 void AsyncProcess::run(std::stringstream &stdin, const std::chrono::milliseconds &relativeTime,
 	bool &timeout, bool splitStdoutLines, bool splitStderrLines)
 {
-	timeout = false;
-
 	run(stdin, splitStdoutLines, splitStderrLines);
+	waitFor(relativeTime, timeout);
+}
 
-	if (relativeTime == std::chrono::milliseconds(0))
-		return;
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	std::cv_status cvStatus;
+void AsyncProcess::run(const Encoding &stdin, bool splitStdoutLines, bool splitStderrLines)
+{
+	// The writer holds on to the segments, so the encoding need not outlive the process
+	auto segments = std::make_shared<const std::vector<Encoding::Segment>>(stdin.segments());
 
-	while (waitForEvent(relativeTime, cvStatus))
+	auto vectors = std::make_shared<std::vector<iovec>>();
+	vectors->reserve(segments->size());
+
+	std::for_each(segments->cbegin(), segments->cend(), [&](const auto &segment)
 	{
-		if (cvStatus != std::cv_status::timeout)
-			continue;
+		vectors->push_back({const_cast<char *>(segment->data()), segment->size()});
+	});
 
-		// Handle timeouts
-		kill();
-		timeout = true;
-	}
+	auto nextVector = std::make_shared<size_t>(0);
+
+	const auto writeStdin = [segments, vectors, nextVector](int fileDescriptor)
+	{
+		auto &next = *nextVector;
+
+		if (next == vectors->size())
+			return false;
+
+		const auto count = std::min<size_t>(vectors->size() - next, IOV_MAX);
+		auto written = writev(fileDescriptor, vectors->data() + next, count);
+
+		if (written < 0)
+		{
+			if (errno == EAGAIN || errno == EINTR)
+				return true;
+
+			// Killed processes stop reading their input
+			if (errno != EPIPE)
+				std::cerr << "[Error] Couldn't write entire buffer" << std::endl;
+
+			next = vectors->size();
+			return false;
+		}
+
+		// Skip the completely written segments and advance into the partially written one
+		while (next < vectors->size() && static_cast<size_t>(written) >= (*vectors)[next].iov_len)
+		{
+			written -= (*vectors)[next].iov_len;
+			next++;
+		}
+
+		if (next < vectors->size())
+		{
+			auto &vector = (*vectors)[next];
+			vector.iov_base = static_cast<char *>(vector.iov_base) + written;
+			vector.iov_len -= written;
+		}
+
+		return true;
+	};
+
+	start(writeStdin, splitStdoutLines, splitStderrLines);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool AsyncProcess::isRunning() const
+void AsyncProcess::run(const Encoding &stdin, const std::chrono::milliseconds &relativeTime,
+	bool &timeout, bool splitStdoutLines, bool splitStderrLines)
 {
-	return m_eventSemaphore.isActive();
+	run(stdin, splitStdoutLines, splitStderrLines);
+	waitFor(relativeTime, timeout);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AsyncProcess::runPipeline(AsyncProcess &producer, AsyncProcess &consumer, const Encoding &stdin,
+	const std::chrono::milliseconds &producerTimeout, bool &producerTimedOut,
+	const std::chrono::milliseconds &consumerTimeout, bool &consumerTimedOut, double &producerTime)
+{
+	producerTimedOut = false;
+	consumerTimedOut = false;
+	producerTime = 0.0;
+
+	std::array<int, 2> connection;
+
+	if (pipe2(connection.data(), O_CLOEXEC) == -1)
+	{
+		std::cerr << "[Error] Could not create pipes" << std::endl;
+		return;
+	}
+
+	producer.m_stdoutFileDescriptor = connection[1];
+	consumer.m_stdinFileDescriptor = connection[0];
+
+	const auto startTime = std::chrono::high_resolution_clock::now();
+
+	producer.run(stdin);
+	consumer.start(nullptr, false, false);
+
+	producer.waitFor(producerTimeout, producerTimedOut);
+	producer.join();
+
+	producerTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+
+	// The consumer must not continue with incomplete input
+	if (producerTimedOut)
+	{
+		if (consumer.exists())
+			consumer.kill();
+	}
+	else
+		consumer.waitFor(consumerTimeout, consumerTimedOut);
+
+	consumer.join();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void AsyncProcess::runThread(std::stringstream &stdin)
+void AsyncProcess::start(StdinWriter writeStdin, bool splitStdoutLines, bool splitStderrLines)
 {
+	BOOST_ASSERT_MSG(!m_isStarted, "[Error] Process started twice without being joined");
+
+	m_childPID = 0;
+	m_exitCode = -1;
+	m_eventSemaphore.reset();
+
+	m_isStarted = true;
+	m_isFinished = false;
+
+	m_stdout.splitLines = splitStdoutLines;
 	m_stdout.streams.clear();
 	m_stdout.streams.resize(1);
+	m_stdout.lines.clear();
+	m_stderr.splitLines = splitStderrLines;
 	m_stderr.streams.clear();
 	m_stderr.streams.resize(1);
+	m_stderr.lines.clear();
+
+	m_writeStdin = std::move(writeStdin);
+	m_buffer.resize(m_configuration.bufferSize);
+
+	m_inPipe = {{-1, -1}};
+	m_outPipe = {{-1, -1}};
 
-	// Pipe for stdin
-	if (pipe(m_inPipe.data()) == -1 || pipe(m_outPipe.data()) == -1 || pipe(m_errPipe.data()) == -1)
+	BOOST_ASSERT(m_stdinFileDescriptor != -1 || m_writeStdin);
+
+	// Processes may be killed while their input is still being written
+	ignoreBrokenPipes();
+
+	// The child is either not started or published before cancel() can look for it
+	std::unique_lock<std::mutex> cancelLock(m_cancelMutex);
+
+	if (m_cancelled)
+	{
+		closeConnections();
+		finish(-1);
+		return;
+	}
+
+	// Pipes for stdin and stdout, unless they are connected to other processes. Close-on-exec keeps
+	// processes forked concurrently by other threads from holding the pipes open
+	if ((m_stdinFileDescriptor == -1 && pipe2(m_inPipe.data(), O_CLOEXEC) == -1)
+		|| (m_stdoutFileDescriptor == -1 && pipe2(m_outPipe.data(), O_CLOEXEC) == -1)
+		|| pipe2(m_errPipe.data(), O_CLOEXEC) == -1)
 	{
 		std::cerr << "[Error] Could not create pipes" << std::endl;
+		closeConnections();
+		finish(-1);
 		return;
 	}
 
@@ -186,6 +384,8 @@ void AsyncProcess::runThread(std::stringstream &stdin)
 	if (pid == -1)
 	{
 		std::cerr << "[Error] Could not fork process" << std::endl;
+		closeConnections();
+		finish(-1);
 		return;
 	}
 	// Child process
@@ -195,13 +395,44 @@ void AsyncProcess::runThread(std::stringstream &stdin)
 	else
 	{
 		m_childPID = pid;
-		runParentProcess(stdin);
+		cancelLock.unlock();
+
+		registerParentFileDescriptors();
 	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void AsyncProcess::runParentProcess(std::stringstream &stdin)
+void AsyncProcess::waitFor(const std::chrono::milliseconds &relativeTime, bool &timeout)
+{
+	timeout = false;
+
+	if (relativeTime == std::chrono::milliseconds(0))
+		return;
+
+	std::cv_status cvStatus;
+
+	while (waitForEvent(relativeTime, cvStatus))
+	{
+		if (cvStatus != std::cv_status::timeout)
+			continue;
+
+		// Handle timeouts
+		kill();
+		timeout = true;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool AsyncProcess::isRunning() const
+{
+	return m_eventSemaphore.isActive();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AsyncProcess::registerParentFileDescriptors()
 {
 	const auto &childReadIn = m_inPipe[0];
 	const auto &parentWriteIn = m_inPipe[1];
@@ -210,161 +441,162 @@ void AsyncProcess::runParentProcess(std::stringstream &stdin)
 	const auto &parentReadErr = m_errPipe[0];
 	const auto &childWriteErr = m_errPipe[1];
 
-	close(childReadIn);
-	close(childWriteOut);
 	close(childWriteErr);
 
-	std::array<std::stringstream::char_type, 1024> buffer;
-
-	const auto maxFD = std::max(std::max(parentReadOut, parentReadErr), parentWriteIn);
-
-	const auto handleWrite = [&]()
-	{
-		if (!stdin.good())
-		{
-			close(parentWriteIn);
-			stdin.str(std::string());
-			return false;
-		}
-
-		stdin.read(buffer.data(), buffer.size());
-		const auto count = stdin.gcount();
-
-		const auto written = write(parentWriteIn, buffer.data(), count);
+	for (auto fileDescriptor : {childReadIn, childWriteOut})
+		if (fileDescriptor != -1)
+			close(fileDescriptor);
 
-		if (written != count)
-			std::cerr << "[Error] Couldn't write entire buffer" << std::endl;
+	// The child owns the file descriptors connected to other processes from now on
+	closeConnections();
 
-		return true;
-	};
+	m_stdinRegistration = {parentWriteIn, 0};
+	m_stdoutRegistration = {parentReadOut, 0};
+	m_stderrRegistration = {parentReadErr, 0};
 
-	const auto handleRead = [&](auto fileDescriptor, auto &outputPipe)
-	{
-		const auto count = read(fileDescriptor, buffer.data(), buffer.size());
+	const auto registrations = {&m_stdinRegistration, &m_stdoutRegistration, &m_stderrRegistration};
 
-		if (count == 0)
+	// Count all file descriptors first, as the reactor may handle them as soon as they are added
+	m_openFileDescriptors = std::count_if(registrations.begin(), registrations.end(),
+		[](const auto registration)
 		{
-			close(fileDescriptor);
-			return false;
-		}
+			return registration->fileDescriptor != -1;
+		});
 
-		if (outputPipe.splitLines)
-		{
-			auto start = buffer.cbegin();
-			auto end = buffer.cbegin() + count;
-
-			while (auto newlinePosition = std::find(start, end, '\n'))
-			{
-				if (newlinePosition == end)
-					break;
+	for (const auto registration : registrations)
+	{
+		if (registration->fileDescriptor == -1)
+			continue;
 
-				{
-					std::lock_guard<std::mutex> lock(outputPipe.accessMutex);
+		const auto flags = fcntl(registration->fileDescriptor, F_GETFL);
 
-					auto &workingStream = outputPipe.streams.back();
-					workingStream.write(start, newlinePosition - start).flush();
-					workingStream << std::endl;
+		if (flags == -1 || fcntl(registration->fileDescriptor, F_SETFL, flags | O_NONBLOCK) == -1)
+			std::cerr << "[Error] Could not make pipe nonblocking" << std::endl;
+	}
 
-					outputPipe.streams.resize(outputPipe.streams.size() + 1);
-				}
+	auto &processReactor = ProcessReactor::instance();
 
-				m_eventSemaphore.notify();
+	if (parentReadOut != -1)
+		m_stdoutRegistration.handle = processReactor.add(parentReadOut, EPOLLIN,
+			[this](uint32_t events)
+			{
+				handleRead(m_stdoutRegistration, m_stdout, events);
+			});
 
-				start = newlinePosition + 1;
-			}
+	m_stderrRegistration.handle = processReactor.add(parentReadErr, EPOLLIN,
+		[this](uint32_t events)
+		{
+			handleRead(m_stderrRegistration, m_stderr, events);
+		});
 
-			if (start < end)
+	if (parentWriteIn != -1)
+		m_stdinRegistration.handle = processReactor.add(parentWriteIn, EPOLLOUT,
+			[this](uint32_t events)
 			{
-				std::lock_guard<std::mutex> lock(outputPipe.accessMutex);
-				outputPipe.streams.back().write(start, end - start).flush();
-			}
-		}
-		else
-		{
-			std::lock_guard<std::mutex> lock(outputPipe.accessMutex);
-			outputPipe.streams.back().write(buffer.data(), count);
-		}
+				handleWrite(events);
+			});
+}
 
-		return true;
-	};
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	bool parentReadOutActive = true;
-	bool parentReadErrActive = true;
-	bool parentWriteInActive = true;
+void AsyncProcess::handleWrite(uint32_t)
+{
+	// Errors on the pipe are reported by the writer
+	if (!m_writeStdin(m_stdinRegistration.fileDescriptor))
+		unregister(m_stdinRegistration);
+}
 
-	const auto waitForInput = [&]()
-	{
-		fd_set readFDSet;
-		fd_set writeFDSet;
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		int numberOfEvents = -1;
+void AsyncProcess::handleRead(Registration &registration, Pipe &outputPipe, uint32_t)
+{
+	// Hang-ups are detected by reading the end of the output
+	if (read(registration.fileDescriptor, outputPipe))
+		return;
 
-		while (true)
-		{
-			FD_ZERO(&readFDSet);
-			FD_ZERO(&writeFDSet);
+	if (outputPipe.splitLines && outputPipe.lines.flush())
+		m_eventSemaphore.notify();
 
-			if (parentReadOutActive)
-				FD_SET(parentReadOut, &readFDSet);
+	unregister(registration);
+}
 
-			if (parentReadErrActive)
-				FD_SET(parentReadErr, &readFDSet);
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-			if (parentWriteInActive)
-				FD_SET(parentWriteIn, &writeFDSet);
+bool AsyncProcess::read(int fileDescriptor, Pipe &outputPipe)
+{
+	const auto count = ::read(fileDescriptor, m_buffer.data(), m_buffer.size());
 
-			numberOfEvents = select(maxFD + 1, &readFDSet, &writeFDSet, nullptr, nullptr);
+	if (count < 0)
+		return errno == EAGAIN || errno == EINTR;
 
-			if (numberOfEvents != -1 || errno != EINTR)
-				break;
-		}
+	if (count == 0)
+		return false;
 
-		if (numberOfEvents < 0)
-		{
-			std::cerr << "[Error] select failed" << std::endl;
-			exit(EXIT_FAILURE);
-		}
+	// Wake up the consumer once per batch of lines
+	if (outputPipe.splitLines)
+	{
+		if (outputPipe.lines.append(m_buffer.data(), count) > 0)
+			m_eventSemaphore.notify();
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(outputPipe.accessMutex);
+		outputPipe.streams.back().write(m_buffer.data(), count);
+	}
 
-		if (FD_ISSET(parentReadOut, &readFDSet))
-			parentReadOutActive &= handleRead(parentReadOut, m_stdout);
+	return true;
+}
 
-		if (FD_ISSET(parentReadErr, &readFDSet))
-			parentReadErrActive &= handleRead(parentReadErr, m_stderr);
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		if (FD_ISSET(parentWriteIn, &writeFDSet))
-			parentWriteInActive &= handleWrite();
+void AsyncProcess::unregister(Registration &registration)
+{
+	ProcessReactor::instance().remove(registration.handle, registration.fileDescriptor);
+	close(registration.fileDescriptor);
+	registration.fileDescriptor = -1;
 
-		return parentReadOutActive || parentReadErrActive || parentWriteInActive;
-	};
+	BOOST_ASSERT(m_openFileDescriptors > 0);
 
-	while (waitForInput());
+	if (--m_openFileDescriptors == 0)
+		reap();
+}
 
-	const auto finishReading = [&](auto fileDescriptor, auto &outputPipe)
-	{
-		if (fcntl(fileDescriptor, F_GETFD) == -1 && errno == EBADF)
-			return;
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-		while (handleRead(fileDescriptor, outputPipe));
-	};
+void AsyncProcess::reap()
+{
+	int status = 0;
 
-	finishReading(parentReadOut, m_stdout);
-	finishReading(parentReadErr, m_stderr);
+	if (waitpid(m_childPID, &status, WNOHANG) == m_childPID)
+	{
+		finish(status);
+		return;
+	}
 
-	close(parentReadOut);
-	close(parentReadErr);
+	// Processes rarely keep running after closing their output, but must not block the reactor then
+	std::thread([this]()
+	{
+		int status = 0;
+		waitpid(m_childPID, &status, 0);
+		finish(status);
+	}).detach();
+}
 
-	// Clear fail flags from stdin
-	stdin.clear();
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	int status = 0;
-	waitpid(m_childPID, &status, 0);
+void AsyncProcess::finish(int status)
+{
+	if (m_childPID != 0)
+	{
+		m_exitCode = WEXITSTATUS(status);
 
-	m_exitCode = WEXITSTATUS(status);
+		m_childPID = 0;
 
-	m_childPID = 0;
+		if (m_exitCode == 255)
+			std::cerr << "[Error] Could not execute process" << std::endl;
+	}
 
-	if (m_exitCode == 255)
-		std::cerr << "[Error] Could not execute process" << std::endl;
+	m_writeStdin = nullptr;
 
 	// Add an empty stringstream to make readers see the last line of output
 	{
@@ -378,6 +610,23 @@ void AsyncProcess::runParentProcess(std::stringstream &stdin)
 
 	// Notify about possibly pending lines
 	m_eventSemaphore.notifyFinished();
+
+	// The process may be destroyed as soon as it is joined, so it must not be accessed afterward
+	std::lock_guard<std::mutex> lock(m_finishedMutex);
+	m_isFinished = true;
+	m_finishedCondition.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void AsyncProcess::closeConnections()
+{
+	for (auto fileDescriptor : {m_stdinFileDescriptor, m_stdoutFileDescriptor})
+		if (fileDescriptor != -1)
+			close(fileDescriptor);
+
+	m_stdinFileDescriptor = -1;
+	m_stdoutFileDescriptor = -1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -391,22 +640,30 @@ void AsyncProcess::runChildProcess()
 	const auto &parentReadErr = m_errPipe[0];
 	const auto &childWriteErr = m_errPipe[1];
 
-	close(parentWriteIn);
-	close(parentReadOut);
+	const auto stdinSource = (m_stdinFileDescriptor != -1) ? m_stdinFileDescriptor : childReadIn;
+	const auto stdoutTarget = (m_stdoutFileDescriptor != -1) ? m_stdoutFileDescriptor : childWriteOut;
+
+	for (auto fileDescriptor : {parentWriteIn, parentReadOut})
+		if (fileDescriptor != -1)
+			close(fileDescriptor);
+
 	close(parentReadErr);
 
-	if (dup2(childReadIn, STDIN_FILENO) < 0
-		|| dup2(childWriteOut, STDOUT_FILENO) < 0
+	if (dup2(stdinSource, STDIN_FILENO) < 0
+		|| dup2(stdoutTarget, STDOUT_FILENO) < 0
 		|| dup2(childWriteErr, STDERR_FILENO) < 0)
 	{
 		perror("dup2 failed");
 		exit(EXIT_FAILURE);
 	}
 
-	close(childReadIn);
-	close(childWriteOut);
+	close(stdinSource);
+	close(stdoutTarget);
 	close(childWriteErr);
 
+	// Ignored signals would be inherited by the executed binary
+	signal(SIGPIPE, SIG_DFL);
+
 	// Remove const qualifier, as execvp does not write to argv
 	// http://pubs.opengroup.org/onlinepubs/9699919799/functions/exec.html
 	const auto unconst = [](const auto &string)
@@ -436,6 +693,18 @@ bool AsyncProcess::exists() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void AsyncProcess::cancel()
+{
+	std::lock_guard<std::mutex> lock(m_cancelMutex);
+
+	m_cancelled = true;
+
+	if (exists())
+		::kill(m_childPID, SIGKILL);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void AsyncProcess::terminate() const
 {
 	if (!exists())
@@ -495,16 +764,18 @@ int AsyncProcess::exitCode() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void AsyncProcess::join() const
+void AsyncProcess::join()
 {
-	BOOST_ASSERT_MSG(m_thread, "[Error] No thread to join");
-	BOOST_ASSERT_MSG(m_thread->joinable(), "[Error] Thread not joinable");
+	BOOST_ASSERT_MSG(m_isStarted, "[Error] No process to join");
 
-	m_thread->join();
+	{
+		std::unique_lock<std::mutex> lock(m_finishedMutex);
+		m_finishedCondition.wait(lock, [&]() {return m_isFinished;});
+	}
 
 	BOOST_ASSERT(!isRunning());
 
-	m_thread.reset(nullptr);
+	m_isStarted = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
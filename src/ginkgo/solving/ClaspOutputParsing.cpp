@@ -1,5 +1,6 @@
 #include <ginkgo/solving/ClaspOutputParsing.h>
 
+#include <algorithm>
 #include <iostream>
 #include <boost/assert.hpp>
 #include <json/json.h>
@@ -61,6 +62,41 @@ Satisfiability parseForSatisfiability(std::stringstream &claspOutputJson)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+bool parseForModel(const Json::Value &claspOutput, std::vector<std::string> &atoms)
+{
+	atoms.clear();
+
+	try
+	{
+		const auto &calls = claspOutput["Call"];
+
+		if (!calls.isArray() || calls.empty())
+			return false;
+
+		const auto &witnesses = calls[0]["Witnesses"];
+
+		if (!witnesses.isArray() || witnesses.empty())
+			return false;
+
+		const auto &value = witnesses[0]["Value"];
+
+		std::for_each(value.begin(), value.end(), [&](const auto &atom)
+		{
+			atoms.push_back(atom.asString());
+		});
+	}
+	catch (std::exception &e)
+	{
+		std::cout << "[Warn ] Could not parse clasp output for models" << std::endl;
+		atoms.clear();
+		return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool parseForErrors(std::stringstream &claspOutput)
 {
 	return claspOutput.str().find("***") != std::string::npos;
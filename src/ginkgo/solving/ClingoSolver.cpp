@@ -0,0 +1,502 @@
+#include <ginkgo/solving/ClingoSolver.h>
+
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+
+#include <clingo.hh>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ClingoSolver
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static Json::Value statisticsToJSON(const Clingo::Statistics &statistics)
+{
+	switch (statistics.type())
+	{
+		case Clingo::StatisticsType::Value:
+			return statistics.value();
+
+		case Clingo::StatisticsType::Array:
+		{
+			Json::Value result = Json::arrayValue;
+
+			for (size_t i = 0; i < statistics.size(); i++)
+				result.append(statisticsToJSON(statistics[i]));
+
+			return result;
+		}
+
+		case Clingo::StatisticsType::Map:
+		{
+			Json::Value result = Json::objectValue;
+
+			for (const auto key : statistics.keys())
+				result[key] = statisticsToJSON(statistics[key]);
+
+			return result;
+		}
+
+		default:
+			return Json::nullValue;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Copies the shown atoms of models, which are only valid while the solver reports them
+class ModelRecorder : public Clingo::SolveEventHandler
+{
+	public:
+		ModelRecorder(std::vector<std::string> &model)
+		:	m_model(model)
+		{
+		}
+
+		bool on_model(Clingo::Model &model) override
+		{
+			const auto symbols = model.symbols();
+
+			m_model.clear();
+			m_model.reserve(symbols.size());
+
+			std::transform(symbols.begin(), symbols.end(), std::back_inserter(m_model),
+				[](const auto &symbol)
+				{
+					return symbol.to_string();
+				});
+
+			return true;
+		}
+
+	private:
+		std::vector<std::string> &m_model;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ClingoSolver::ClingoSolver(std::vector<std::string> arguments)
+:	m_arguments{std::move(arguments)},
+	m_solvingControl{nullptr},
+	m_interrupted{false},
+	m_groundingTime{0.0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ClingoSolver::~ClingoSolver()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClingoSolver::computeUniqueModel(const std::string &program, const std::chrono::milliseconds &timeout,
+	std::vector<std::string> &atoms)
+{
+	// The model is unique if the brave and cautious consequences coincide
+	const auto consequences = [&](const std::string &enumerationMode, std::vector<std::string> &consequences)
+	{
+		ClingoSolver solver({"--enum-mode=" + enumerationMode, "--models=0"});
+
+		bool groundingTimeout = false;
+		bool solvingTimeout = false;
+
+		if (solver.solve(program, timeout, groundingTimeout, solvingTimeout) != Satisfiability::Satisfiable)
+			return false;
+
+		consequences = solver.model();
+		std::sort(consequences.begin(), consequences.end());
+
+		return true;
+	};
+
+	std::vector<std::string> braveConsequences;
+	std::vector<std::string> cautiousConsequences;
+
+	if (!consequences("brave", braveConsequences) || !consequences("cautious", cautiousConsequences)
+		|| braveConsequences != cautiousConsequences)
+	{
+		return false;
+	}
+
+	atoms = std::move(braveConsequences);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<Clingo::Control> ClingoSolver::createControl()
+{
+	std::vector<const char *> arguments;
+	arguments.reserve(m_arguments.size());
+	std::transform(m_arguments.cbegin(), m_arguments.cend(), std::back_inserter(arguments),
+		[](const auto &argument)
+		{
+			return argument.c_str();
+		});
+
+	return std::make_unique<Clingo::Control>(arguments,
+		[&](Clingo::WarningCode code, const char *message)
+		{
+			// Undefined atoms are expected in proof encodings
+			if (code == Clingo::WarningCode::AtomUndefined)
+				return;
+
+			m_warnings += message;
+			m_warnings += "\n";
+		}, 20);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Satisfiability ClingoSolver::solve(const std::string &program, const std::chrono::milliseconds &timeout,
+	bool &groundingTimeout, bool &solvingTimeout)
+{
+	return solve(program, {}, timeout, groundingTimeout, solvingTimeout);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Satisfiability ClingoSolver::solve(const std::string &program, const std::vector<Assumption> &assumptions,
+	const std::chrono::milliseconds &timeout, bool &groundingTimeout, bool &solvingTimeout)
+{
+	return solve(std::vector<const char *>{program.c_str()}, assumptions, timeout, groundingTimeout, solvingTimeout);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Satisfiability ClingoSolver::solve(const Encoding &program, const std::vector<Assumption> &assumptions,
+	const std::chrono::milliseconds &timeout, bool &groundingTimeout, bool &solvingTimeout)
+{
+	const auto &segments = program.segments();
+
+	std::vector<const char *> programParts;
+	programParts.reserve(segments.size());
+	std::transform(segments.cbegin(), segments.cend(), std::back_inserter(programParts),
+		[](const auto &segment)
+		{
+			return segment->c_str();
+		});
+
+	return solve(programParts, assumptions, timeout, groundingTimeout, solvingTimeout);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Satisfiability ClingoSolver::solve(const std::vector<const char *> &programParts, const std::vector<Assumption> &assumptions,
+	const std::chrono::milliseconds &timeout, bool &groundingTimeout, bool &solvingTimeout)
+{
+	groundingTimeout = false;
+	solvingTimeout = false;
+
+	resetStatistics();
+
+	{
+		std::lock_guard<std::mutex> lock(m_interruptMutex);
+
+		if (m_interrupted)
+			return Satisfiability::Unknown;
+	}
+
+	try
+	{
+		auto control = createControl();
+
+		const auto groundingStartTime = std::chrono::high_resolution_clock::now();
+
+		for (const auto &programPart : programParts)
+			control->add("base", {}, programPart);
+
+		control->ground({{"base", {}}});
+		const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+
+		m_groundingTime = std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count();
+
+		// Grounding cannot be interrupted in-process, so timeouts are only detected afterward
+		if (timeout != std::chrono::milliseconds(0)
+			&& groundingFinishedTime - groundingStartTime > timeout)
+		{
+			groundingTimeout = true;
+			return Satisfiability::Unknown;
+		}
+
+		return solve(*control, assumptions, timeout, solvingTimeout);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "[Error] clingo failed: " << e.what() << std::endl;
+		return Satisfiability::Unknown;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClingoSolver::add(const std::string &partName, const std::vector<std::string> &parameters,
+	const std::string &program)
+{
+	if (!m_session)
+		m_session = createControl();
+
+	std::vector<const char *> parameterNames;
+	parameterNames.reserve(parameters.size());
+	std::transform(parameters.cbegin(), parameters.cend(), std::back_inserter(parameterNames),
+		[](const auto &parameter)
+		{
+			return parameter.c_str();
+		});
+
+	m_session->add(partName.c_str(), parameterNames, program.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClingoSolver::ground(const std::string &partName, const std::vector<int> &arguments)
+{
+	if (!m_session)
+		m_session = createControl();
+
+	std::vector<Clingo::Symbol> symbolicArguments;
+	symbolicArguments.reserve(arguments.size());
+	std::transform(arguments.cbegin(), arguments.cend(), std::back_inserter(symbolicArguments),
+		[](const auto &argument)
+		{
+			return Clingo::Number(argument);
+		});
+
+	const auto groundingStartTime = std::chrono::high_resolution_clock::now();
+	m_session->ground({{partName.c_str(), Clingo::SymbolSpan(symbolicArguments)}});
+	const auto groundingFinishedTime = std::chrono::high_resolution_clock::now();
+
+	m_groundingTime += std::chrono::duration<double>(groundingFinishedTime - groundingStartTime).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Satisfiability ClingoSolver::solve(const std::vector<Assumption> &assumptions, const std::chrono::milliseconds &timeout,
+	bool &solvingTimeout)
+{
+	solvingTimeout = false;
+
+	m_statistics = Json::Value();
+
+	if (!m_session)
+		m_session = createControl();
+
+	try
+	{
+		return solve(*m_session, assumptions, timeout, solvingTimeout);
+	}
+	catch (const std::exception &e)
+	{
+		std::cerr << "[Error] clingo failed: " << e.what() << std::endl;
+		return Satisfiability::Unknown;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Satisfiability ClingoSolver::solve(Clingo::Control &control, const std::vector<Assumption> &assumptions,
+	const std::chrono::milliseconds &timeout, bool &solvingTimeout)
+{
+	std::vector<Clingo::SymbolicLiteral> symbolicAssumptions;
+	symbolicAssumptions.reserve(assumptions.size());
+
+	std::transform(assumptions.cbegin(), assumptions.cend(), std::back_inserter(symbolicAssumptions),
+		[](const auto &assumption)
+		{
+			return Clingo::SymbolicLiteral(Clingo::parse_term(assumption.first.c_str()), assumption.second);
+		});
+
+	m_model.clear();
+	ModelRecorder modelRecorder(m_model);
+
+	const auto solvingStartTime = std::chrono::high_resolution_clock::now();
+
+	auto handle = control.solve(Clingo::SymbolicLiteralSpan(symbolicAssumptions), &modelRecorder, true, false);
+
+	{
+		std::lock_guard<std::mutex> lock(m_interruptMutex);
+
+		if (m_interrupted)
+			control.interrupt();
+
+		m_solvingControl = &control;
+	}
+
+	if (timeout != std::chrono::milliseconds(0)
+		&& !handle.wait(std::chrono::duration<double>(timeout).count()))
+	{
+		handle.cancel();
+		solvingTimeout = true;
+	}
+
+	const auto result = handle.get();
+	const auto solvingFinishedTime = std::chrono::high_resolution_clock::now();
+
+	m_core.clear();
+
+	if (!solvingTimeout && !result.is_interrupted() && result.is_unsatisfiable())
+	{
+		const auto core = handle.core();
+		const auto symbolicAtoms = control.symbolic_atoms();
+
+		// Map the solver literals in the core back to the assumed atoms
+		for (size_t i = 0; i < assumptions.size(); i++)
+		{
+			if (!assumptions[i].second)
+				continue;
+
+			const auto symbolicAtom = symbolicAtoms.find(Clingo::parse_term(assumptions[i].first.c_str()));
+
+			if (symbolicAtom == symbolicAtoms.end())
+				continue;
+
+			const auto literal = symbolicAtom->literal();
+
+			if (std::find(core.begin(), core.end(), literal) != core.end())
+				m_core.push_back(assumptions[i].first);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_interruptMutex);
+		m_solvingControl = nullptr;
+	}
+
+	auto satisfiability = Satisfiability::Unknown;
+
+	if (!solvingTimeout && !result.is_interrupted())
+	{
+		if (result.is_unsatisfiable())
+			satisfiability = Satisfiability::Unsatisfiable;
+		else if (result.is_satisfiable())
+			satisfiability = Satisfiability::Satisfiable;
+	}
+
+	if (satisfiability != Satisfiability::Satisfiable)
+		m_model.clear();
+
+	// Mimic the relevant parts of clasp's JSON output
+	const auto version = Clingo::version();
+	const auto statistics = control.statistics();
+	const auto summary = statistics["summary"];
+
+	std::stringstream solverName;
+	solverName << "clingo version " << std::get<0>(version) << "." << std::get<1>(version)
+		<< "." << std::get<2>(version) << " (library)";
+
+	m_statistics["Solver"] = solverName.str();
+
+	if (satisfiability == Satisfiability::Unsatisfiable)
+		m_statistics["Result"] = "UNSATISFIABLE";
+	else if (satisfiability == Satisfiability::Satisfiable)
+		m_statistics["Result"] = "SATISFIABLE";
+	else
+		m_statistics["Result"] = "UNKNOWN";
+
+	m_statistics["Models"]["Number"] = static_cast<Json::UInt64>(summary["models"]["enumerated"].value());
+	m_statistics["Models"]["More"] = satisfiability == Satisfiability::Satisfiable ? "yes" : "no";
+	m_statistics["Calls"] = 1;
+	m_statistics["Time"]["Total"] = std::chrono::duration<double>(solvingFinishedTime - solvingStartTime).count();
+	m_statistics["Time"]["Solve"] = summary["times"]["solve"].value();
+	m_statistics["Time"]["Model"] = summary["times"]["sat"].value();
+	m_statistics["Time"]["Unsat"] = summary["times"]["unsat"].value();
+	m_statistics["Time"]["CPU"] = summary["times"]["cpu"].value();
+	m_statistics["Stats"] = statisticsToJSON(statistics);
+
+	return satisfiability;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClingoSolver::releaseExternal(const std::string &atom)
+{
+	if (!m_session)
+		return;
+
+	m_session->release_external(Clingo::parse_term(atom.c_str()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClingoSolver::interrupt()
+{
+	std::lock_guard<std::mutex> lock(m_interruptMutex);
+
+	m_interrupted = true;
+
+	if (m_solvingControl)
+		m_solvingControl->interrupt();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ClingoSolver::hasSession() const
+{
+	return m_session != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClingoSolver::reset()
+{
+	m_session.reset();
+	resetStatistics();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+double ClingoSolver::groundingTime() const
+{
+	return m_groundingTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ClingoSolver::resetStatistics()
+{
+	m_groundingTime = 0.0;
+	m_statistics = Json::Value();
+	m_warnings.clear();
+	m_core.clear();
+	m_model.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const Json::Value &ClingoSolver::statistics() const
+{
+	return m_statistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string &ClingoSolver::warnings() const
+{
+	return m_warnings;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<std::string> &ClingoSolver::core() const
+{
+	return m_core;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<std::string> &ClingoSolver::model() const
+{
+	return m_model;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -1,5 +1,6 @@
 #include <ginkgo/solving/Constraint.h>
 
+#include <cctype>
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -17,10 +18,38 @@ namespace ginkgo
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Constraint::Constraint(size_t id, const std::string &string, SymbolTable &symbolTable)
-:	m_id(id),
-	m_lbd(0)
+// Widens the time range by the time argument of a literal
+static void extendTimeRange(boost::string_ref name, size_t time, size_t &timeMin, size_t &timeMax)
 {
+	// Actions require at least one preceding time step in order to check preconditions
+	if (name == "apply" || name == "del")
+		timeMin = std::min(timeMin, time - 1);
+	else
+		timeMin = std::min(timeMin, time);
+
+	timeMax = std::max(timeMax, time);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ConstraintPtr Constraint::parse(size_t id, boost::string_ref string, SymbolTable &symbolTable,
+	const ConstraintFilter &filter, FilterResult &filterResult)
+{
+	ConstraintPtr constraint(new Constraint);
+	constraint->m_id = id;
+	constraint->m_lbd = 0;
+
+	size_t timeMin = std::numeric_limits<size_t>::max();
+	size_t timeMax = std::numeric_limits<size_t>::min();
+
+	// The time range only widens once it is nonempty, so a range exceeding the limit stays rejected
+	const auto exceedsMaxDegree = [&]()
+	{
+		return timeMin <= timeMax && timeMax - timeMin > filter.maxDegree;
+	};
+
+	// Dropped literals are kept only for detecting duplicates
+	Literals removedLiterals;
 	size_t position = 0;
 
 	while (position < string.size())
@@ -36,19 +65,92 @@ Constraint::Constraint(size_t id, const std::string &string, SymbolTable &symbol
 
 		Literal literal(string, position, symbolTable);
 
-		if (std::find(m_literals.cbegin(), m_literals.cend(), literal) == m_literals.cend())
-			m_literals.push_back(literal);
+		if (literal.hasTimeArgument())
+			extendTimeRange(*literal.name(), literal.timeArgument(), timeMin, timeMax);
+
+		if (exceedsMaxDegree())
+		{
+			filterResult = FilterResult::DegreeTooHigh;
+			return nullptr;
+		}
+
+		auto &literals = (*literal.name() == filter.removedLiteralName) ? removedLiterals : constraint->m_literals;
+
+		if (std::find(literals.cbegin(), literals.cend(), literal) == literals.cend())
+			literals.push_back(std::move(literal));
+
+		if (constraint->m_literals.size() + removedLiterals.size() > filter.maxNumberOfLiterals)
+			break;
+	}
+
+	if (constraint->m_literals.size() + removedLiterals.size() > filter.maxNumberOfLiterals)
+	{
+		// The degree filter applies first, so the time arguments of the remaining literals are still read
+		while (position < string.size() && string[position] != '.')
+		{
+			if (!isAlphanumeric(string[position]))
+			{
+				position++;
+				continue;
+			}
+
+			bool hasTimeArgument;
+			size_t timeArgument;
+
+			const auto name = Literal::skip(string, position, hasTimeArgument, timeArgument);
+
+			if (hasTimeArgument)
+				extendTimeRange(name, timeArgument, timeMin, timeMax);
+
+			if (exceedsMaxDegree())
+				break;
+		}
 	}
 
-	const std::string lbdPattern = "lbd=";
-	size_t lbdPosition = string.find(lbdPattern, position);
+	// Same check as for the parsed time range, including constraints without time arguments
+	if (timeMax - timeMin > filter.maxDegree)
+		filterResult = FilterResult::DegreeTooHigh;
+	else if (constraint->m_literals.size() + removedLiterals.size() > filter.maxNumberOfLiterals)
+		filterResult = FilterResult::ContainsTooManyLiterals;
+	else if (constraint->m_literals.empty())
+		filterResult = FilterResult::Empty;
+	else
+		filterResult = FilterResult::Accepted;
+
+	if (filterResult != FilterResult::Accepted)
+		return nullptr;
+
+	constraint->parseLBD(string, position);
+
+	return constraint;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Constraint::Constraint(size_t id, boost::string_ref string, SymbolTable &symbolTable)
+:	m_id(id),
+	m_lbd(0)
+{
+	size_t position = 0;
 
-	if (lbdPosition != std::string::npos)
+	while (position < string.size())
 	{
-		std::stringstream stream(string);
-		stream.seekg(lbdPosition + lbdPattern.size());
-		stream >> m_lbd;
+		if (string[position] == '.')
+			break;
+
+		if (!isAlphanumeric(string[position]))
+		{
+			position++;
+			continue;
+		}
+
+		Literal literal(string, position, symbolTable);
+
+		if (std::find(m_literals.cbegin(), m_literals.cend(), literal) == m_literals.cend())
+			m_literals.push_back(std::move(literal));
 	}
+
+	parseLBD(string, position);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,9 +192,22 @@ size_t Constraint::lbd() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+size_t Constraint::hash() const
+{
+	// Literals are unique, so summing up their hashes doesn't cancel out duplicates
+	size_t hash = 0;
+
+	for (const auto &literal : m_literals)
+		hash += literal.hash();
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool Constraint::subsumes(const Constraint &rhs) const
 {
-	for (const auto literal : m_literals)
+	for (const auto &literal : m_literals)
 		if (std::find(rhs.literals().begin(), rhs.literals().end(), literal) == rhs.literals().end())
 			return false;
 
@@ -106,7 +221,7 @@ bool Constraint::subsumes(const Constraint &rhs, int offset) const
 	if (offset == 0)
 		return subsumes(rhs);
 
-	for (const auto lhsLiteral : m_literals)
+	for (const auto &lhsLiteral : m_literals)
 	{
 		if (std::find_if(rhs.literals().begin(), rhs.literals().end(),
 			[&](const auto &rhsLiteral)
@@ -145,6 +260,21 @@ std::ostream &operator<<(std::ostream &ostream, const Constraint &constraint)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+bool operator==(const Constraint &a, const Constraint &b)
+{
+	// Literals are unique, so equal sizes and subsumption imply equal sets
+	return a.numberOfLiterals() == b.numberOfLiterals() && a.subsumes(b);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool operator!=(const Constraint &a, const Constraint &b)
+{
+	return !(a == b);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 std::tuple<size_t, size_t> Constraint::timeRange() const
 {
 	// Currently, normalization only works for plasp-formatted encodings
@@ -158,17 +288,7 @@ std::tuple<size_t, size_t> Constraint::timeRange() const
 	size_t timeMax = std::numeric_limits<size_t>::min();
 
 	for (const auto &literal : m_literals)
-	{
-		const auto time = literal.timeArgument();
-
-		// Actions require at least one preceding time step in order to check preconditions
-		if (*literal.name() == "apply" || *literal.name() == "del")
-			timeMin = std::min(timeMin, time - 1);
-		else
-			timeMin = std::min(timeMin, time);
-
-		timeMax = std::max(timeMax, time);
-	}
+		extendTimeRange(*literal.name(), literal.timeArgument(), timeMin, timeMax);
 
 	return std::make_tuple(timeMin, timeMax);
 }
@@ -198,6 +318,27 @@ ConstraintPtr Constraint::withoutLiterals(size_t index, size_t length) const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+ConstraintPtr Constraint::withLiterals(const std::vector<size_t> &indices) const
+{
+	BOOST_ASSERT(std::is_sorted(indices.cbegin(), indices.cend()));
+
+	ConstraintPtr result(new Constraint);
+	result->m_id = m_id;
+	result->m_lbd = 0;
+
+	result->m_literals.reserve(indices.size());
+
+	std::for_each(indices.cbegin(), indices.cend(), [&](const auto index)
+	{
+		BOOST_ASSERT(index < m_literals.size());
+		result->m_literals.push_back(m_literals[index]);
+	});
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Constraint::removeLiterals(const std::string &literalName)
 {
 	m_literals.erase(std::remove_if(m_literals.begin(), m_literals.end(),
@@ -209,6 +350,26 @@ void Constraint::removeLiterals(const std::string &literalName)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void Constraint::parseLBD(boost::string_ref string, size_t position)
+{
+	const boost::string_ref lbdPattern = "lbd=";
+	const auto lbdPosition = string.substr(std::min(position, string.size())).find(lbdPattern);
+
+	if (lbdPosition == boost::string_ref::npos)
+		return;
+
+	// Skip whitespace before the number like formatted input does
+	position += lbdPosition + lbdPattern.size();
+
+	while (position < string.size() && std::isspace(string[position]))
+		position++;
+
+	for (; position < string.size() && isNumeric(string[position]); position++)
+		m_lbd = 10 * m_lbd + (string[position] - '0');
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Constraint::print(std::ostream &ostream) const
 {
 	ostream << ":- ";
@@ -0,0 +1,119 @@
+#include <ginkgo/solving/EncodingBuilder.h>
+
+#include <numeric>
+#include <sstream>
+
+#include <ginkgo/solving/GeneralizedConstraint.h>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Encoding
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Encoding::append(Segment segment)
+{
+	if (!segment || segment->empty())
+		return;
+
+	m_segments.push_back(std::move(segment));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Encoding::append(const std::vector<Segment> &segments)
+{
+	m_segments.reserve(m_segments.size() + segments.size());
+
+	for (const auto &segment : segments)
+		append(segment);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Encoding::append(std::string text)
+{
+	if (text.empty())
+		return;
+
+	m_segments.push_back(std::make_shared<const std::string>(std::move(text)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Encoding::Segment> &Encoding::segments() const
+{
+	return m_segments;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t Encoding::size() const
+{
+	return std::accumulate(m_segments.cbegin(), m_segments.cend(), size_t(0),
+		[](size_t size, const auto &segment) {return size + segment->size();});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string Encoding::str() const
+{
+	std::string result;
+	result.reserve(size());
+
+	for (const auto &segment : m_segments)
+		result += *segment;
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EncodingBuilder
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+EncodingBuilder::EncodingBuilder()
+:	m_program{std::make_shared<const std::string>()}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void EncodingBuilder::setProgram(std::string program)
+{
+	m_program = std::make_shared<const std::string>(std::move(program));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const Encoding::Segment &EncodingBuilder::program() const
+{
+	return m_program;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void EncodingBuilder::addLearnedConstraint(const ConstraintPtr &learnedConstraint)
+{
+	std::stringstream learnedConstraintStream;
+
+	GeneralizedConstraint(learnedConstraint).print(learnedConstraintStream);
+	learnedConstraintStream << std::endl;
+
+	m_learnedConstraints.push_back(std::make_shared<const std::string>(learnedConstraintStream.str()));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::vector<Encoding::Segment> &EncodingBuilder::learnedConstraints() const
+{
+	return m_learnedConstraints;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
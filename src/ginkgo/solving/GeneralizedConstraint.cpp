@@ -68,10 +68,40 @@ bool GeneralizedConstraint::subsumes(const Constraint &rhs) const
 	const auto &rhsTimeMin = std::get<0>(rhsTimeRange);
 	const auto &rhsTimeMax = std::get<1>(rhsTimeRange);
 
-	for (size_t t0 = rhsTimeMin; t0 + lhsDegree <= rhsTimeMax; t0++)
+	const auto isInRange = [&](size_t t0)
 	{
-		// Shift the generalized constraint and test it against the other constraint
-		if (m_originalConstraint->subsumes(rhs, lhsOffset + t0))
+		return t0 >= rhsTimeMin && t0 + lhsDegree <= rhsTimeMax;
+	};
+
+	const auto &lhsLiterals = m_originalConstraint->literals();
+
+	if (lhsLiterals.empty() || !lhsLiterals.front().hasTimeArgument())
+	{
+		for (size_t t0 = rhsTimeMin; t0 + lhsDegree <= rhsTimeMax; t0++)
+		{
+			// Shift the generalized constraint and test it against the other constraint
+			if (m_originalConstraint->subsumes(rhs, lhsOffset + t0))
+				return true;
+		}
+
+		return false;
+	}
+
+	// The first literal only matches literals with the same term, which determine the candidate shifts
+	const auto &firstLiteral = lhsLiterals.front();
+
+	for (const auto &literal : rhs.literals())
+	{
+		if (literal.sign() != firstLiteral.sign() || literal.term() != firstLiteral.term()
+			|| !literal.hasTimeArgument())
+		{
+			continue;
+		}
+
+		const auto offset = static_cast<int>(literal.timeArgument() - firstLiteral.timeArgument());
+		const size_t t0 = offset - lhsOffset;
+
+		if (isInRange(t0) && m_originalConstraint->subsumes(rhs, offset))
 			return true;
 	}
 
@@ -0,0 +1,445 @@
+#include <ginkgo/solving/GroundProgram.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <vector>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// GroundProgram
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class AspifStatementType
+{
+	End = 0,
+	Rule = 1,
+	Minimize = 2,
+	Projection = 3,
+	Output = 4,
+	External = 5,
+	Assumption = 6,
+	Heuristic = 7,
+	Edge = 8,
+	Theory = 9,
+	Comment = 10
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Statement of the aspif format, whose arguments exclude the string of output statements
+struct AspifStatement
+{
+	AspifStatementType type;
+	std::vector<int> arguments;
+	std::string string;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Atoms in rule heads cannot be identified with atoms of another program, as they would be redefined
+enum class AspifPosition
+{
+	Head,
+	Atom,
+	Literal
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool readInteger(const std::string &line, size_t &position, int &value)
+{
+	while (position < line.size() && line[position] == ' ')
+		position++;
+
+	if (position == line.size())
+		return false;
+
+	const auto *begin = line.c_str() + position;
+	char *end;
+	const auto result = std::strtol(begin, &end, 10);
+
+	if (end == begin)
+		return false;
+
+	position += end - begin;
+	value = static_cast<int>(result);
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool parseStatement(const std::string &line, AspifStatement &statement)
+{
+	size_t position = 0;
+	int value;
+
+	statement.arguments.clear();
+	statement.string.clear();
+
+	if (!readInteger(line, position, value) || value < 0 || value > static_cast<int>(AspifStatementType::Comment))
+		return false;
+
+	statement.type = static_cast<AspifStatementType>(value);
+
+	// Comments are dropped
+	if (statement.type == AspifStatementType::Comment)
+		return true;
+
+	// The string of output statements may contain spaces and is thus preceded by its length
+	if (statement.type == AspifStatementType::Output)
+	{
+		if (!readInteger(line, position, value) || value < 0 || position >= line.size() || line[position] != ' '
+			|| position + 1 + value > line.size())
+		{
+			return false;
+		}
+
+		statement.string = line.substr(position + 1, value);
+		position += 1 + value;
+	}
+
+	while (readInteger(line, position, value))
+		statement.arguments.push_back(value);
+
+	return position == line.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void printStatement(std::ostream &ostream, const AspifStatement &statement)
+{
+	ostream << static_cast<int>(statement.type);
+
+	if (statement.type == AspifStatementType::Output)
+		ostream << " " << statement.string.size() << " " << statement.string;
+
+	std::for_each(statement.arguments.cbegin(), statement.arguments.cend(), [&](const auto &argument)
+	{
+		ostream << " " << argument;
+	});
+
+	ostream << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Applies the function to all atoms and literals of the statement, which fails if the statement is
+// malformed or the function fails
+static bool forEachAtom(AspifStatement &statement, const std::function<bool (int &, AspifPosition)> &function)
+{
+	auto &arguments = statement.arguments;
+
+	// Applies the function to the elements listed after their number, with weights if the stride is 2
+	const auto forEachListed = [&](size_t index, size_t stride, AspifPosition position, size_t &end)
+	{
+		if (index >= arguments.size() || arguments[index] < 0)
+			return false;
+
+		const auto size = static_cast<size_t>(arguments[index]);
+		end = index + 1 + size * stride;
+
+		if (end > arguments.size())
+			return false;
+
+		for (size_t i = 0; i < size; i++)
+			if (!function(arguments[index + 1 + i * stride], position))
+				return false;
+
+		return true;
+	};
+
+	size_t end = 0;
+
+	switch (statement.type)
+	{
+		case AspifStatementType::Rule:
+		{
+			// Head type, head atoms, body type, and the (weighted) body literals
+			if (arguments.empty() || !forEachListed(1, 1, AspifPosition::Head, end) || end >= arguments.size())
+				return false;
+
+			const auto bodyType = arguments[end];
+
+			if (bodyType == 0)
+				return forEachListed(end + 1, 1, AspifPosition::Literal, end) && end == arguments.size();
+
+			return bodyType == 1 && forEachListed(end + 2, 2, AspifPosition::Literal, end) && end == arguments.size();
+		}
+		case AspifStatementType::Minimize:
+			return forEachListed(1, 2, AspifPosition::Literal, end) && end == arguments.size();
+		case AspifStatementType::Projection:
+			return forEachListed(0, 1, AspifPosition::Atom, end) && end == arguments.size();
+		case AspifStatementType::Output:
+		case AspifStatementType::Assumption:
+			return forEachListed(0, 1, AspifPosition::Literal, end) && end == arguments.size();
+		case AspifStatementType::External:
+			return arguments.size() == 2 && function(arguments[0], AspifPosition::Atom);
+		case AspifStatementType::Heuristic:
+			return arguments.size() >= 5 && function(arguments[1], AspifPosition::Atom)
+				&& forEachListed(4, 1, AspifPosition::Literal, end) && end == arguments.size();
+		case AspifStatementType::Edge:
+			return forEachListed(2, 1, AspifPosition::Literal, end) && end == arguments.size();
+		case AspifStatementType::Comment:
+			return true;
+		default:
+			return false;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reads the statements of a single step and fails if the program is not in the aspif format
+static bool parseProgram(const std::string &aspif, const std::function<bool (AspifStatement &)> &handleStatement,
+	size_t &endPosition)
+{
+	auto lineEnd = aspif.find('\n');
+
+	// Incremental programs consist of multiple steps, which cannot be appended to
+	if (lineEnd == std::string::npos || aspif.compare(0, 6, "asp 1 ") != 0
+		|| aspif.substr(0, lineEnd).find("incremental") != std::string::npos)
+	{
+		return false;
+	}
+
+	AspifStatement statement;
+
+	while (lineEnd != std::string::npos)
+	{
+		const auto lineStart = lineEnd + 1;
+		lineEnd = aspif.find('\n', lineStart);
+
+		const auto line = aspif.substr(lineStart, lineEnd == std::string::npos ? std::string::npos : lineEnd - lineStart);
+
+		if (!parseStatement(line, statement))
+			return false;
+
+		if (statement.type == AspifStatementType::End)
+		{
+			endPosition = lineStart;
+			return true;
+		}
+
+		if (!handleStatement(statement))
+			return false;
+	}
+
+	return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Shown terms other than atoms cannot be declared as externals
+static bool isAtom(const std::string &term)
+{
+	const size_t start = (!term.empty() && term[0] == '-') ? 1 : 0;
+
+	return term.size() > start && std::islower(static_cast<unsigned char>(term[start]));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+GroundProgram::GroundProgram()
+:	m_numberOfAtoms{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool GroundProgram::read(const std::string &aspif)
+{
+	int numberOfAtoms = 0;
+	std::vector<std::string> shownAtoms;
+	std::unordered_map<std::string, std::vector<std::vector<int>>> conditions;
+
+	const auto handleStatement = [&](AspifStatement &statement)
+	{
+		const auto isWellFormed = forEachAtom(statement, [&](int &value, AspifPosition)
+		{
+			numberOfAtoms = std::max(numberOfAtoms, std::abs(value));
+			return true;
+		});
+
+		if (!isWellFormed)
+			return false;
+
+		if (statement.type == AspifStatementType::Output && isAtom(statement.string))
+		{
+			auto &atomConditions = conditions[statement.string];
+
+			if (atomConditions.empty())
+				shownAtoms.push_back(statement.string);
+
+			atomConditions.emplace_back(statement.arguments.cbegin() + 1, statement.arguments.cend());
+		}
+
+		return true;
+	};
+
+	size_t endPosition;
+
+	if (!parseProgram(aspif, handleStatement, endPosition))
+		return false;
+
+	std::stringstream program;
+	program << aspif.substr(0, endPosition);
+
+	std::stringstream interfaceEncoding;
+	m_shownAtoms.clear();
+
+	std::for_each(shownAtoms.cbegin(), shownAtoms.cend(), [&](const auto &shownAtom)
+	{
+		const auto &atomConditions = conditions[shownAtom];
+
+		const auto isFact = std::any_of(atomConditions.cbegin(), atomConditions.cend(),
+			[](const auto &condition) {return condition.empty();});
+
+		if (isFact)
+		{
+			interfaceEncoding << shownAtom << "." << std::endl;
+			m_shownAtoms[shownAtom] = 0;
+			return;
+		}
+
+		// Externals are shown explicitly, so that they can be identified regardless of other #show statements
+		interfaceEncoding
+			<< "#external " << shownAtom << "." << std::endl
+			<< "#show " << shownAtom << " : " << shownAtom << "." << std::endl;
+
+		if (atomConditions.size() == 1 && atomConditions.front().size() == 1)
+		{
+			m_shownAtoms[shownAtom] = atomConditions.front().front();
+			return;
+		}
+
+		// Atoms shown under several conditions or conjunctions are replaced with an auxiliary atom
+		numberOfAtoms++;
+		m_shownAtoms[shownAtom] = numberOfAtoms;
+
+		std::for_each(atomConditions.cbegin(), atomConditions.cend(), [&](const auto &condition)
+		{
+			program << "1 0 1 " << numberOfAtoms << " 0 " << condition.size();
+
+			std::for_each(condition.cbegin(), condition.cend(), [&](const auto &literal)
+			{
+				program << " " << literal;
+			});
+
+			program << std::endl;
+		});
+	});
+
+	m_program = std::make_shared<const std::string>(program.str());
+	m_interfaceEncoding = std::make_shared<const std::string>(interfaceEncoding.str());
+	m_numberOfAtoms = numberOfAtoms;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const Encoding::Segment &GroundProgram::interfaceEncoding() const
+{
+	return m_interfaceEncoding;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool GroundProgram::append(const std::string &aspif, Encoding &linkedProgram) const
+{
+	if (!m_program)
+		return false;
+
+	std::vector<AspifStatement> statements;
+
+	// Atoms of the appended program identified with atoms of this program
+	std::unordered_map<int, int> linkedAtoms;
+
+	const auto handleStatement = [&](AspifStatement &statement)
+	{
+		if (statement.type == AspifStatementType::Comment)
+			return true;
+
+		if (statement.type == AspifStatementType::Output)
+		{
+			const auto shownAtom = m_shownAtoms.find(statement.string);
+
+			// Shown atoms of this program are already output by it
+			if (shownAtom != m_shownAtoms.cend())
+			{
+				const auto &condition = statement.arguments;
+
+				// Facts of the interface are simplified away by the grounder
+				if (condition.size() == 1 && condition[0] == 0)
+					return shownAtom->second == 0;
+
+				// Externals of the interface are output with their atom
+				if (condition.size() != 2 || condition[0] != 1 || condition[1] <= 0 || shownAtom->second == 0)
+					return false;
+
+				linkedAtoms[condition[1]] = shownAtom->second;
+				return true;
+			}
+		}
+
+		statements.push_back(statement);
+		return true;
+	};
+
+	size_t endPosition;
+
+	if (!parseProgram(aspif, handleStatement, endPosition))
+		return false;
+
+	const auto link = [&](int &value, AspifPosition position)
+	{
+		const auto atom = std::abs(value);
+		const auto linkedAtom = linkedAtoms.find(atom);
+
+		if (linkedAtom == linkedAtoms.cend())
+		{
+			value = (value > 0 ? 1 : -1) * (atom + m_numberOfAtoms);
+			return true;
+		}
+
+		if (position == AspifPosition::Head)
+			return false;
+
+		value = (value > 0) ? linkedAtom->second : -linkedAtom->second;
+
+		return position == AspifPosition::Literal || value > 0;
+	};
+
+	std::stringstream appendedProgram;
+
+	for (auto &statement : statements)
+	{
+		// Externals of the interface are defined by this program
+		if (statement.type == AspifStatementType::External && statement.arguments.size() == 2
+			&& linkedAtoms.find(statement.arguments[0]) != linkedAtoms.cend())
+			continue;
+
+		if (!forEachAtom(statement, link))
+			return false;
+
+		printStatement(appendedProgram, statement);
+	}
+
+	appendedProgram << static_cast<int>(AspifStatementType::End) << std::endl;
+
+	linkedProgram.append(m_program);
+	linkedProgram.append(appendedProgram.str());
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
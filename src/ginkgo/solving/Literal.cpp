@@ -4,6 +4,7 @@
 #include <sstream>
 #include <algorithm>
 #include <boost/assert.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <ginkgo/utils/Utils.h>
 
@@ -22,81 +23,230 @@ const std::set<std::string> Literal::SupportedTimeIdentifiers =
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Literal::Literal(const std::string &string, size_t &startPosition, SymbolTable &symbolTable)
-:	m_name{nullptr},
-	m_hasTimeArgument{false}
+// Compares against the supported identifiers without constructing a string
+static bool isTimeIdentifier(boost::string_ref name)
 {
-	// Check sign
-	m_sign = string.substr(startPosition, 4) != "not ";
+	return std::any_of(Literal::SupportedTimeIdentifiers.cbegin(), Literal::SupportedTimeIdentifiers.cend(),
+		[&](const auto &timeIdentifier)
+		{
+			return name == boost::string_ref(timeIdentifier);
+		});
+}
 
-	if (!m_sign)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reads the leading digits of a time argument, with an optional plus sign like std::stoul
+static bool parseTimeArgument(boost::string_ref string, size_t &timeArgument)
+{
+	size_t position = 0;
+
+	if (position < string.size() && string[position] == '+')
+		position++;
+
+	if (position == string.size() || !isNumeric(string[position]))
+		return false;
+
+	timeArgument = 0;
+
+	for (; position < string.size() && isNumeric(string[position]); position++)
+		timeArgument = 10 * timeArgument + (string[position] - '0');
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Follows the grammar of the parsing constructor and returns the name of the literal
+static boost::string_ref skipLiteral(boost::string_ref string, size_t &startPosition, bool &hasArguments,
+	boost::string_ref &lastArgumentName)
+{
+	if (string.substr(startPosition, 4) == "not ")
 		startPosition += 4;
 
 	auto position = startPosition;
 
-	// Extract name
+	while (position < string.size() && isAlphanumeric(string[position]))
+		position++;
+
+	const auto name = string.substr(startPosition, position - startPosition);
+
+	hasArguments = false;
+
+	if (position >= string.size() || string[position] != '(')
+	{
+		startPosition = position;
+		return name;
+	}
+
+	position++;
+
+	size_t depth = 0;
+
 	while (position < string.size())
 	{
-		if (!isAlphanumeric(string[position]))
+		const auto character = string[position];
+
+		if (character == ')' && depth == 0)
 			break;
 
-		position++;
+		if (character == '(')
+			depth++;
+		else if (character == ')')
+			depth--;
+
+		if (!isAlphanumeric(character))
+		{
+			position++;
+			continue;
+		}
+
+		bool argumentHasArguments;
+		boost::string_ref argumentLastArgumentName;
+
+		lastArgumentName = skipLiteral(string, position, argumentHasArguments, argumentLastArgumentName);
+		hasArguments = true;
 	}
 
-	BOOST_ASSERT_MSG(position < string.size(), "Could not parse literal.");
+	startPosition = std::min(position + 1, string.size());
 
-	const auto name = string.substr(startPosition, position - startPosition);
-	m_name = symbolTable.identifier(name);
+	return name;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const SymbolTable::Term *parseTerm(boost::string_ref string, size_t &startPosition,
+	SymbolTable &symbolTable, std::vector<const SymbolTable::Term *> &argumentStack);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Parses the name of a term and pushes its interned arguments onto the shared stack
+static SymbolTable::Symbol parseArguments(boost::string_ref string, size_t &startPosition,
+	SymbolTable &symbolTable, std::vector<const SymbolTable::Term *> &argumentStack)
+{
+	auto position = startPosition;
+
+	// Extract name
+	while (position < string.size() && isAlphanumeric(string[position]))
+		position++;
+
+	const auto symbol = symbolTable.symbol(string.substr(startPosition, position - startPosition));
 
 	// Check for arguments
-	if (string[position] != '(')
+	if (position >= string.size() || string[position] != '(')
+	{
 		startPosition = position;
-	else
+		return symbol;
+	}
+
+	position++;
+
+	// Parentheses not belonging to arguments, such as those of tuples, are skipped
+	size_t depth = 0;
+
+	// Extract arguments up to the matching right parenthesis
+	while (position < string.size())
 	{
-		const auto leftBracketPosition = position;
-		const auto rightBracketPosition = findMatchingRightParenthesis(string, position);
+		const auto character = string[position];
 
-		// Extract arguments
-		position = leftBracketPosition + 1;
+		if (character == ')' && depth == 0)
+			break;
 
-		while (position < rightBracketPosition)
-		{
-			if (!isAlphanumeric(string[position]))
-			{
-				position++;
-				continue;
-			}
+		if (character == '(')
+			depth++;
+		else if (character == ')')
+			depth--;
 
-			m_arguments.emplace_back(Literal(string, position, symbolTable));
+		if (!isAlphanumeric(character))
+		{
+			position++;
+			continue;
 		}
 
-		startPosition = rightBracketPosition + 1;
+		const auto argument = parseTerm(string, position, symbolTable, argumentStack);
+		argumentStack.push_back(argument);
 	}
 
-	if (!m_arguments.empty()
-		&& SupportedTimeIdentifiers.find(*m_name) != SupportedTimeIdentifiers.end())
+	startPosition = std::min(position + 1, string.size());
+
+	return symbol;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Parses a term like a literal without a sign
+static const SymbolTable::Term *parseTerm(boost::string_ref string, size_t &startPosition,
+	SymbolTable &symbolTable, std::vector<const SymbolTable::Term *> &argumentStack)
+{
+	const auto argumentsBegin = argumentStack.size();
+	const auto symbol = parseArguments(string, startPosition, symbolTable, argumentStack);
+
+	const auto term = symbolTable.term(symbol, argumentStack.data() + argumentsBegin,
+		argumentStack.size() - argumentsBegin);
+	argumentStack.resize(argumentsBegin);
+
+	return term;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Literal::Literal(boost::string_ref string, size_t &startPosition, SymbolTable &symbolTable)
+:	m_term{nullptr},
+	m_timeArgument{0},
+	m_hasTimeArgument{false}
+{
+	// Check sign
+	m_sign = string.substr(startPosition, 4) != "not ";
+
+	if (!m_sign)
+		startPosition += 4;
+
+	// Reused by all literals, so that argument lists are only allocated once they are interned
+	static thread_local std::vector<const SymbolTable::Term *> argumentStack;
+
+	const auto argumentsBegin = argumentStack.size();
+	const auto symbol = parseArguments(string, startPosition, symbolTable, argumentStack);
+	auto numberOfArguments = argumentStack.size() - argumentsBegin;
+
+	if (numberOfArguments > 0 && isTimeIdentifier(symbolTable.name(symbol)))
 	{
-		try
-		{
-			m_timeArgument = std::stoul(*m_arguments.back().name());
-			m_hasTimeArgument = true;
-		}
-		catch (const std::exception &e)
-		{
-			std::cout << "[Warn ] Reading time argument failed: " << e.what() << std::endl;
-		}
+		const auto &timeArgument = *argumentStack.back()->name;
+
+		m_hasTimeArgument = parseTimeArgument(timeArgument, m_timeArgument);
+
+		// The time argument is kept separately, so that the term is the same for all time steps
+		if (m_hasTimeArgument)
+			numberOfArguments--;
+		else
+			std::cout << "[Warn ] Reading time argument failed: " << timeArgument << std::endl;
 	}
+
+	m_term = symbolTable.term(symbol, argumentStack.data() + argumentsBegin, numberOfArguments);
+	argumentStack.resize(argumentsBegin);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Literal::Literal(const SymbolTable::Term *term, bool sign)
+:	m_term{term},
+	m_timeArgument{0},
+	m_sign{sign},
+	m_hasTimeArgument{false}
+{
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Literal::Literal(const Literal &copy)
-:	m_sign(copy.m_sign),
-	m_name(copy.m_name),
-	m_arguments(copy.m_arguments),
-	m_hasTimeArgument(copy.m_hasTimeArgument),
-	m_timeArgument(copy.m_timeArgument)
+boost::string_ref Literal::skip(boost::string_ref string, size_t &startPosition, bool &hasTimeArgument,
+	size_t &timeArgument)
 {
+	bool hasArguments;
+	boost::string_ref lastArgumentName;
+
+	const auto name = skipLiteral(string, startPosition, hasArguments, lastArgumentName);
+
+	hasTimeArgument = hasArguments && isTimeIdentifier(name) && parseTimeArgument(lastArgumentName, timeArgument);
+
+	return name;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,18 +258,36 @@ bool Literal::sign() const
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const std::string *Literal::name() const
+const SymbolTable::Term *Literal::term() const
 {
-	BOOST_ASSERT(m_name);
+	return m_term;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolTable::Symbol Literal::symbol() const
+{
+	return m_term->symbol;
+}
 
-	return m_name;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string *Literal::name() const
+{
+	return m_term->name;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const Literals &Literal::arguments() const
+Literals Literal::arguments() const
 {
-	return m_arguments;
+	Literals arguments;
+	arguments.reserve(m_term->arguments.size());
+
+	for (const auto *argument : m_term->arguments)
+		arguments.push_back(Literal(argument, true));
+
+	return arguments;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,47 +310,37 @@ size_t Literal::timeArgument() const
 
 bool Literal::equalsShifted(const Literal &rhs, int offset) const
 {
-	if (m_sign != rhs.sign())
-		return false;
-
-	if (m_arguments.size() != rhs.arguments().size())
-		return false;
-
-	if (hasTimeArgument() != rhs.hasTimeArgument())
-		return false;
-
-	// Compare all but the last argument (time argument)
-	for (size_t i = 0; i < m_arguments.size() - 1; i++)
-	{
-		if (m_arguments[i] != rhs.arguments()[i])
-			return false;
-	}
+	// Terms don't contain the time arguments, so only the latter are compared with the offset
+	return m_sign == rhs.m_sign && m_term == rhs.m_term && timeArgument() + offset == rhs.timeArgument();
+}
 
-	// Compare time argument with offset
-	if (timeArgument() + offset != rhs.timeArgument())
-		return false;
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	if (m_name != rhs.name())
-		return false;
+size_t Literal::hash() const
+{
+	size_t hash = m_term->id;
+	boost::hash_combine(hash, m_sign);
+	boost::hash_combine(hash, m_timeArgument);
 
-	return true;
+	return hash;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-Literal Literal::normalized(int offset, SymbolTable &symbolTable) const
+size_t Literal::hashWithoutTime() const
 {
-	BOOST_ASSERT(!m_arguments.empty());
+	size_t hash = m_term->id;
+	boost::hash_combine(hash, m_sign);
 
-	Literal result;
-	result.m_name = m_name;
-	result.m_sign = m_sign;
-	result.m_arguments = m_arguments;
+	return hash;
+}
 
-	if (offset == 0)
-		return result;
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	result.m_arguments.back().m_name = symbolTable.identifier(std::to_string(timeArgument() + offset));
+Literal Literal::normalized(int offset) const
+{
+	Literal result = *this;
+	result.m_timeArgument = timeArgument() + offset;
 
 	return result;
 }
@@ -200,23 +358,9 @@ std::ostream &operator<<(std::ostream &ostream, const Literal &literal)
 
 bool operator==(const Literal &a, const Literal &b)
 {
-	if (a.sign() != b.sign())
-		return false;
-
-	if (a.name() != b.name())
-		return false;
-
-	const auto &aArguments = a.arguments();
-	const auto &bArguments = b.arguments();
-
-	if (aArguments.size() != bArguments.size())
-		return false;
-
-	for (size_t i = 0; i < aArguments.size(); i++)
-		if (aArguments[i] != bArguments[i])
-			return false;
-
-	return true;
+	// Terms are interned, so equal terms are identical
+	return a.sign() == b.sign() && a.term() == b.term() && a.hasTimeArgument() == b.hasTimeArgument()
+		&& (!a.hasTimeArgument() || a.timeArgument() == b.timeArgument());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,27 +372,48 @@ bool operator!=(const Literal &a, const Literal &b)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static void printTerm(std::ostream &ostream, const SymbolTable::Term &term)
+{
+	ostream << *term.name;
+
+	if (term.arguments.empty())
+		return;
+
+	ostream << "(";
+
+	for (size_t i = 0; i < term.arguments.size(); i++)
+	{
+		if (i != 0)
+			ostream << ", ";
+
+		printTerm(ostream, *term.arguments[i]);
+	}
+
+	ostream << ")";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void Literal::print(std::ostream &ostream) const
 {
 	if (m_sign == false)
 		ostream << "not ";
 
-	ostream << *m_name;
-
-	if (!m_arguments.empty())
+	if (!m_hasTimeArgument)
 	{
-		ostream << "(";
-
-		for (size_t i = 0; i < m_arguments.size(); i++)
-		{
-			if (i != 0)
-				ostream << ", ";
+		printTerm(ostream, *m_term);
+		return;
+	}
 
-			ostream << m_arguments[i];
-		}
+	ostream << *m_term->name << "(";
 
-		ostream << ")";
+	for (const auto *argument : m_term->arguments)
+	{
+		printTerm(ostream, *argument);
+		ostream << ", ";
 	}
+
+	ostream << m_timeArgument << ")";
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -256,54 +421,50 @@ void Literal::print(std::ostream &ostream) const
 void Literal::print(std::ostream &ostream, OutputFormat outputFormat, int offset) const
 {
 	// Currently, normalization only works for plasp-formatted encodings
-	BOOST_ASSERT_MSG(SupportedTimeIdentifiers.find(*m_name) != SupportedTimeIdentifiers.end(),
+	BOOST_ASSERT_MSG(SupportedTimeIdentifiers.find(*m_term->name) != SupportedTimeIdentifiers.end(),
 		"Identifier unsupported");
 
 	if (m_sign == false)
 		ostream << "not ";
 
-	ostream << *m_name;
-
-	if (!m_arguments.empty())
+	if (!m_hasTimeArgument)
 	{
-		ostream << "(";
+		printTerm(ostream, *m_term);
+		return;
+	}
 
-		// Don't touch all but the time argument (last argument)
-		for (size_t i = 0; i < m_arguments.size() - 1; i++)
-		{
-			if (i != 0)
-				ostream << ", ";
+	ostream << *m_term->name << "(";
 
-			ostream << m_arguments[i];
-		}
+	// Don't touch all but the time argument
+	for (const auto *argument : m_term->arguments)
+	{
+		printTerm(ostream, *argument);
+		ostream << ", ";
+	}
 
-		if (m_arguments.size() > 1)
-			ostream << ", ";
+	const auto time = m_timeArgument + offset;
 
-		const auto time = timeArgument() + offset;
+	// Normalize time argument
+	switch (outputFormat)
+	{
+		case OutputFormat::Normal:
+			ostream << time;
+			break;
 
-		// Normalize time argument
-		switch (outputFormat)
+		case OutputFormat::Generalized:
 		{
-			case OutputFormat::Normal:
-				ostream << time;
-				break;
-
-			case OutputFormat::Generalized:
-			{
-				ostream << "T";
+			ostream << "T";
 
-				if (time < 0)
-					ostream << "-" << time;
-				else if (time > 0)
-					ostream << "+" << time;
+			if (time < 0)
+				ostream << "-" << time;
+			else if (time > 0)
+				ostream << "+" << time;
 
-				break;
-			}
+			break;
 		}
-
-		ostream << ")";
 	}
+
+	ostream << ")";
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,9 +1,11 @@
 #include <ginkgo/solving/Process.h>
 
+#include <csignal>
 #include <cstdio>
 #include <unistd.h>
 #include <fcntl.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -13,6 +15,8 @@
 #include <sys/wait.h>
 #include <sys/epoll.h>
 
+#include <ginkgo/utils/Utils.h>
+
 namespace ginkgo
 {
 
@@ -22,6 +26,10 @@ namespace ginkgo
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+const size_t Process::BufferSize = 64 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 Process::Process(std::string binary, const std::vector<std::string> &arguments)
 :	m_binary{binary},
 	m_exitCode{-1}
@@ -55,8 +63,11 @@ void Process::run(std::istream &input, bool reportErrors)
 	m_stderr.str(std::string());
 	m_stderr.clear();
 
+	// Children may exit before reading all of their input
+	ignoreBrokenPipes();
+
 	// Pipe for stdin
-	if (pipe(m_inPipe) == -1 || pipe(m_outPipe) == -1 || pipe(m_errPipe) == -1)
+	if (pipe2(m_inPipe, O_CLOEXEC) == -1 || pipe2(m_outPipe, O_CLOEXEC) == -1 || pipe2(m_errPipe, O_CLOEXEC) == -1)
 		exit(EXIT_FAILURE);
 
 	const pid_t pid = fork();
@@ -124,108 +135,126 @@ void Process::runParentProcess(std::istream &input, bool reportErrors)
 	close(childWriteOut);
 	close(childWriteErr);
 
-	std::stringstream::char_type buffer[1024];
+	std::vector<std::stringstream::char_type> buffer(BufferSize);
+	size_t bufferBegin = 0;
+	size_t bufferEnd = 0;
+
+	const auto epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+
+	if (epollFileDescriptor == -1)
+	{
+		std::cerr << "[Error] epoll failed" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	const auto add = [&](int fileDescriptor, uint32_t events)
+	{
+		const auto flags = fcntl(fileDescriptor, F_GETFL);
+		fcntl(fileDescriptor, F_SETFL, flags | O_NONBLOCK);
+
+		epoll_event event = {};
+		event.events = events;
+		event.data.fd = fileDescriptor;
+		epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event);
+	};
 
-	const auto maxFD = std::max(std::max(parentReadOut, parentReadErr), parentWriteIn);
+	add(parentWriteIn, EPOLLOUT);
+	add(parentReadOut, EPOLLIN);
+	add(parentReadErr, EPOLLIN);
 
 	auto handleWrite = [&]()
 	{
-		if (!input.good())
+		if (bufferBegin == bufferEnd)
 		{
-			close(parentWriteIn);
-			return false;
+			if (!input.good())
+				return false;
+
+			input.read(buffer.data(), buffer.size());
+			bufferBegin = 0;
+			bufferEnd = input.gcount();
 		}
 
-		input.read(buffer, sizeof(buffer));
-		const auto count = input.gcount();
+		const auto written = write(parentWriteIn, buffer.data() + bufferBegin, bufferEnd - bufferBegin);
 
-		const auto written = write(parentWriteIn, buffer, count);
+		if (written < 0)
+		{
+			if (errno == EAGAIN || errno == EINTR)
+				return true;
 
-		if (written != count)
-			std::cerr << "[Error] Couldn't write entire buffer" << std::endl;
+			// The child exited without reading all of its input
+			if (errno != EPIPE)
+				std::cerr << "[Error] Couldn't write entire buffer" << std::endl;
+
+			return false;
+		}
+
+		bufferBegin += written;
 
 		return true;
 	};
 
+	// The input buffer is only in use while writing, so output is read into a separate one
+	std::vector<std::stringstream::char_type> outputBuffer(BufferSize);
+
 	auto handleRead = [&](int fileDescriptor, std::ostream &outputStream, std::mutex &outputStreamMutex)
 	{
-		const auto count = read(fileDescriptor, buffer, sizeof(buffer));
+		const auto count = read(fileDescriptor, outputBuffer.data(), outputBuffer.size());
+
+		if (count < 0)
+			return errno == EAGAIN || errno == EINTR;
 
 		if (count == 0)
-		{
-			close(fileDescriptor);
 			return false;
-		}
 
 		std::lock_guard<std::mutex> lock(outputStreamMutex);
-		outputStream.write(buffer, count).flush();
+		outputStream.write(outputBuffer.data(), count).flush();
 		return true;
 	};
 
-	bool parentReadOutActive = true;
-	bool parentReadErrActive = true;
-	bool parentWriteInActive = true;
+	size_t openFileDescriptors = 3;
 
-	auto waitForInput = [&]()
+	const auto remove = [&](int fileDescriptor)
 	{
-		fd_set readFDSet;
-		fd_set writeFDSet;
-
-		int numberOfEvents = -1;
-
-		while (true)
-		{
-			FD_ZERO(&readFDSet);
-			FD_ZERO(&writeFDSet);
-
-			if (parentReadOutActive)
-				FD_SET(parentReadOut, &readFDSet);
-
-			if (parentReadErrActive)
-				FD_SET(parentReadErr, &readFDSet);
-
-			if (parentWriteInActive)
-				FD_SET(parentWriteIn, &writeFDSet);
+		epoll_ctl(epollFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+		close(fileDescriptor);
+		openFileDescriptors--;
+	};
 
-			numberOfEvents = select(maxFD + 1, &readFDSet, &writeFDSet, nullptr, nullptr);
+	std::array<epoll_event, 3> events;
 
-			if (numberOfEvents != -1 || errno != EINTR)
-				break;
-		}
+	while (openFileDescriptors > 0)
+	{
+		const auto numberOfEvents = epoll_wait(epollFileDescriptor, events.data(), events.size(), -1);
 
 		if (numberOfEvents < 0)
 		{
-			std::cerr << "[Error] select failed" << std::endl;
+			if (errno == EINTR)
+				continue;
+
+			std::cerr << "[Error] epoll failed" << std::endl;
 			exit(EXIT_FAILURE);
 		}
 
-		if (FD_ISSET(parentReadOut, &readFDSet))
-			parentReadOutActive &= handleRead(parentReadOut, m_stdout, m_stdoutMutex);
-
-		if (FD_ISSET(parentReadErr, &readFDSet))
-			parentReadErrActive &= handleRead(parentReadErr, m_stderr, m_stderrMutex);
-
-		if (FD_ISSET(parentWriteIn, &writeFDSet))
-			parentWriteInActive &= handleWrite();
-
-		return parentReadOutActive || parentReadErrActive || parentWriteInActive;
-	};
-
-	while (waitForInput());
-
-	auto finishReading = [&](int fileDescriptor, std::ostream &outputStream, std::mutex &outputStreamMutex)
-	{
-		if (fcntl(fileDescriptor, F_GETFD) == -1 && errno == EBADF)
-			return;
-
-		while (handleRead(fileDescriptor, outputStream, outputStreamMutex));
-	};
-
-	finishReading(parentReadOut, m_stdout, m_stdoutMutex);
-	finishReading(parentReadErr, m_stderr, m_stderrMutex);
+		for (int i = 0; i < numberOfEvents; i++)
+		{
+			const auto fileDescriptor = events[i].data.fd;
+
+			if (fileDescriptor == parentWriteIn)
+			{
+				if (!handleWrite())
+					remove(parentWriteIn);
+			}
+			else if (fileDescriptor == parentReadOut)
+			{
+				if (!handleRead(parentReadOut, m_stdout, m_stdoutMutex))
+					remove(parentReadOut);
+			}
+			else if (!handleRead(parentReadErr, m_stderr, m_stderrMutex))
+				remove(parentReadErr);
+		}
+	}
 
-	close(parentReadOut);
-	close(parentReadErr);
+	close(epollFileDescriptor);
 
 	int status = 0;
 	waitpid(m_childPID, &status, 0);
@@ -266,6 +295,9 @@ void Process::runChildProcess()
 	close(childWriteOut);
 	close(childWriteErr);
 
+	// Ignored signals would be inherited by the executed binary
+	signal(SIGPIPE, SIG_DFL);
+
 	_exit(execvp(m_arguments[0], m_arguments.data()));
 }
 
@@ -0,0 +1,158 @@
+#include <ginkgo/solving/ProcessReactor.h>
+
+#include <csignal>
+#include <cerrno>
+#include <unistd.h>
+
+#include <array>
+#include <iostream>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// ProcessReactor
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Handle of the wake-up file descriptor
+static const ProcessReactor::Handle WakeUpHandle = 0;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProcessReactor &ProcessReactor::instance()
+{
+	static ProcessReactor processReactor;
+
+	return processReactor;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProcessReactor::ProcessReactor()
+:	m_epollFileDescriptor{epoll_create1(EPOLL_CLOEXEC)},
+	m_wakeUpFileDescriptor{eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)},
+	m_nextHandle{WakeUpHandle + 1}
+{
+	if (m_epollFileDescriptor == -1 || m_wakeUpFileDescriptor == -1)
+	{
+		std::cerr << "[Error] Could not create process reactor" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	epoll_event event = {};
+	event.events = EPOLLIN;
+	event.data.u64 = WakeUpHandle;
+
+	epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, m_wakeUpFileDescriptor, &event);
+
+	m_thread = std::thread([this]()
+	{
+		run();
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProcessReactor::~ProcessReactor()
+{
+	const uint64_t value = 1;
+
+	if (write(m_wakeUpFileDescriptor, &value, sizeof(value)) == sizeof(value))
+		m_thread.join();
+	else
+		m_thread.detach();
+
+	close(m_wakeUpFileDescriptor);
+	close(m_epollFileDescriptor);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ProcessReactor::Handle ProcessReactor::add(int fileDescriptor, uint32_t events, Handler handler)
+{
+	Handle handle;
+
+	{
+		std::lock_guard<std::mutex> lock(m_handlersMutex);
+
+		handle = m_nextHandle++;
+		m_handlers.emplace(handle, std::make_shared<Handler>(std::move(handler)));
+	}
+
+	epoll_event event = {};
+	event.events = events;
+	event.data.u64 = handle;
+
+	if (epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event) == -1)
+		std::cerr << "[Error] Could not register file descriptor with process reactor" << std::endl;
+
+	return handle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProcessReactor::remove(Handle handle, int fileDescriptor)
+{
+	epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+
+	std::lock_guard<std::mutex> lock(m_handlersMutex);
+	m_handlers.erase(handle);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ProcessReactor::run()
+{
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGPIPE);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+	std::array<epoll_event, 64> events;
+
+	while (true)
+	{
+		const auto numberOfEvents = epoll_wait(m_epollFileDescriptor, events.data(), events.size(), -1);
+
+		if (numberOfEvents == -1)
+		{
+			if (errno == EINTR)
+				continue;
+
+			std::cerr << "[Error] epoll failed" << std::endl;
+			exit(EXIT_FAILURE);
+		}
+
+		for (int i = 0; i < numberOfEvents; i++)
+		{
+			const auto handle = events[i].data.u64;
+
+			if (handle == WakeUpHandle)
+				return;
+
+			std::shared_ptr<Handler> handler;
+
+			{
+				std::lock_guard<std::mutex> lock(m_handlersMutex);
+
+				const auto match = m_handlers.find(handle);
+
+				// Skip events of registrations removed by earlier handlers
+				if (match == m_handlers.end())
+					continue;
+
+				handler = match->second;
+			}
+
+			(*handler)(events[i].events);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -2,6 +2,9 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
+
+#include <boost/assert.hpp>
 
 namespace ginkgo
 {
@@ -12,18 +15,194 @@ namespace ginkgo
 //
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-const std::string *SymbolTable::identifier(const std::string &identifier)
+static const size_t InitialNumberOfSlots = 1024;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Doubles the number of slots, rehashing the entries given by their indices
+template<class Slots, class Hash>
+static void grow(Slots &slots, size_t numberOfEntries, Hash hash)
+{
+	Slots grownSlots(2 * slots.size(), {0, 0});
+	const auto mask = grownSlots.size() - 1;
+
+	// Rehash from the entries, since the slots only keep the upper bits of the hashes
+	for (size_t entry = 0; entry < numberOfEntries; entry++)
+	{
+		const auto entryHash = hash(entry);
+		auto index = static_cast<size_t>(entryHash) & mask;
+
+		while (grownSlots[index].entry != 0)
+			index = (index + 1) & mask;
+
+		grownSlots[index] = {static_cast<uint32_t>(entryHash >> 32), static_cast<uint32_t>(entry + 1)};
+	}
+
+	slots.swap(grownSlots);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolTable::SymbolTable()
+:	m_slots(InitialNumberOfSlots, Slot{0, 0}),
+	m_termSlots(InitialNumberOfSlots, Slot{0, 0})
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t SymbolTable::hash(boost::string_ref identifier)
+{
+	// 64-bit FNV-1a
+	uint64_t hash = 14695981039346656037ull;
+
+	for (const auto character : identifier)
+	{
+		hash ^= static_cast<unsigned char>(character);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t SymbolTable::hash(Symbol symbol, const Term *const *arguments, size_t numberOfArguments)
+{
+	// Dense IDs only differ in their lower bits, so each one is mixed in with the splitmix64 finalizer
+	const auto mix = [](uint64_t hash)
+	{
+		hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+		hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+
+		return hash ^ (hash >> 31);
+	};
+
+	uint64_t hash = mix(symbol);
+
+	for (size_t i = 0; i < numberOfArguments; i++)
+		hash = mix(hash + arguments[i]->id);
+
+	return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolTable::Symbol SymbolTable::symbol(boost::string_ref identifier)
+{
+	const auto identifierHash = hash(identifier);
+	const auto slotHash = static_cast<uint32_t>(identifierHash >> 32);
+	const auto mask = m_slots.size() - 1;
+
+	auto index = static_cast<size_t>(identifierHash) & mask;
+
+	while (m_slots[index].entry != 0)
+	{
+		const auto &slot = m_slots[index];
+
+		if (slot.hash == slotHash && boost::string_ref(m_names[slot.entry - 1]) == identifier)
+			return slot.entry - 1;
+
+		index = (index + 1) & mask;
+	}
+
+	if (m_names.size() == std::numeric_limits<Symbol>::max())
+	{
+		std::cerr << "[Error] Symbol table is full" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	m_names.emplace_back(identifier.data(), identifier.size());
+
+	const auto symbol = static_cast<Symbol>(m_names.size() - 1);
+	m_slots[index] = {slotHash, symbol + 1};
+
+	if (2 * m_names.size() > m_slots.size())
+		grow(m_slots, m_names.size(), [&](size_t entry)
+		{
+			return hash(m_names[entry]);
+		});
+
+	return symbol;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string &SymbolTable::name(Symbol symbol) const
+{
+	BOOST_ASSERT(symbol < m_names.size());
+
+	return m_names[symbol];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const SymbolTable::Term *SymbolTable::term(Symbol symbol, const Term *const *arguments, size_t numberOfArguments)
 {
-	const auto match = std::find_if(m_identifiers.cbegin(), m_identifiers.cend(), [&](const auto &storedIdentifier)
+	// Constants are looked up directly by their symbols
+	if (numberOfArguments == 0 && symbol < m_constants.size() && m_constants[symbol])
+		return m_constants[symbol];
+
+	const auto termHash = hash(symbol, arguments, numberOfArguments);
+	const auto slotHash = static_cast<uint32_t>(termHash >> 32);
+	const auto mask = m_termSlots.size() - 1;
+
+	auto index = static_cast<size_t>(termHash) & mask;
+
+	while (m_termSlots[index].entry != 0)
+	{
+		const auto &slot = m_termSlots[index];
+		const auto &term = m_terms[slot.entry - 1];
+
+		// Arguments are interned already, so they are compared by their addresses
+		if (slot.hash == slotHash && term.symbol == symbol && term.arguments.size() == numberOfArguments
+			&& std::equal(term.arguments.cbegin(), term.arguments.cend(), arguments))
+		{
+			return &term;
+		}
+
+		index = (index + 1) & mask;
+	}
+
+	if (m_terms.size() == std::numeric_limits<uint32_t>::max())
+	{
+		std::cerr << "[Error] Term table is full" << std::endl;
+		exit(EXIT_FAILURE);
+	}
+
+	const auto id = static_cast<uint32_t>(m_terms.size());
+	m_terms.push_back({symbol, id, &name(symbol), std::vector<const Term *>(arguments, arguments + numberOfArguments)});
+	m_termSlots[index] = {slotHash, id + 1};
+
+	if (2 * m_terms.size() > m_termSlots.size())
+		grow(m_termSlots, m_terms.size(), [&](size_t entry)
+		{
+			const auto &term = m_terms[entry];
+
+			return hash(term.symbol, term.arguments.data(), term.arguments.size());
+		});
+
+	if (numberOfArguments == 0)
 	{
-		return *storedIdentifier == identifier;
-	});
+		m_constants.resize(std::max<size_t>(m_constants.size(), symbol + 1), nullptr);
+		m_constants[symbol] = &m_terms[id];
+	}
+
+	return &m_terms[id];
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
 
-	if (match != m_identifiers.cend())
-		return (*match).get();
+size_t SymbolTable::size() const
+{
+	return m_names.size();
+}
 
-	m_identifiers.push_back(std::make_unique<std::string>(identifier));
-	return m_identifiers.back().get();
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t SymbolTable::numberOfTerms() const
+{
+	return m_terms.size();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+#include <ginkgo/utils/LineQueue.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace ginkgo
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// LineQueue
+//
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const size_t LineQueue::ChunkSize = 1024 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LineQueue::Chunk::Chunk(size_t capacity)
+:	bytes{new char[capacity]},
+	capacity{capacity},
+	size{0},
+	numberOfRecords{0},
+	next{nullptr}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LineQueue::LineQueue()
+:	m_head{new Chunk(ChunkSize)},
+	m_nextRecord{0},
+	m_tail{m_head},
+	m_lineBegin{0}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LineQueue::~LineQueue()
+{
+	while (m_head)
+	{
+		auto *next = m_head->next.load();
+		delete m_head;
+		m_head = next;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+size_t LineQueue::append(const char *data, size_t size)
+{
+	const auto *end = data + size;
+	size_t numberOfLines = 0;
+
+	while (data < end)
+	{
+		const auto *newlinePosition = std::find(data, end, '\n');
+		const size_t pieceSize = newlinePosition - data;
+
+		reserve(pieceSize);
+		std::memcpy(m_tail->bytes.get() + m_tail->size, data, pieceSize);
+		m_tail->size += pieceSize;
+
+		if (newlinePosition == end)
+			break;
+
+		publish();
+		numberOfLines++;
+
+		data = newlinePosition + 1;
+	}
+
+	return numberOfLines;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LineQueue::flush()
+{
+	if (m_tail->size == m_lineBegin)
+		return false;
+
+	publish();
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LineQueue::pop(boost::string_ref &line)
+{
+	while (true)
+	{
+		const auto numberOfRecords = m_head->numberOfRecords.load(std::memory_order_acquire);
+
+		if (m_nextRecord < numberOfRecords)
+		{
+			const auto &record = m_head->records[m_nextRecord];
+			line = boost::string_ref(m_head->bytes.get() + record.begin, record.size);
+			m_nextRecord++;
+
+			return true;
+		}
+
+		auto *next = m_head->next.load(std::memory_order_acquire);
+
+		if (!next)
+			return false;
+
+		// The final records of a chunk are published before the next chunk is linked
+		if (m_nextRecord < m_head->numberOfRecords.load(std::memory_order_acquire))
+			continue;
+
+		delete m_head;
+		m_head = next;
+		m_nextRecord = 0;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineQueue::clear()
+{
+	while (m_head != m_tail)
+	{
+		auto *next = m_head->next.load();
+		delete m_head;
+		m_head = next;
+	}
+
+	m_head->size = 0;
+	m_head->numberOfRecords = 0;
+	m_nextRecord = 0;
+	m_lineBegin = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineQueue::reserve(size_t size)
+{
+	const auto hasRecord = m_tail->numberOfRecords.load(std::memory_order_relaxed) < RecordsPerChunk;
+
+	if (hasRecord && m_tail->size + size <= m_tail->capacity)
+		return;
+
+	const auto lineSize = m_tail->size - m_lineBegin;
+
+	auto *chunk = new Chunk(std::max(ChunkSize, lineSize + size));
+	std::memcpy(chunk->bytes.get(), m_tail->bytes.get() + m_lineBegin, lineSize);
+	chunk->size = lineSize;
+
+	m_tail->next.store(chunk, std::memory_order_release);
+	m_tail = chunk;
+	m_lineBegin = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineQueue::publish()
+{
+	// Empty lines may not have reserved a record yet
+	reserve(0);
+
+	const auto numberOfRecords = m_tail->numberOfRecords.load(std::memory_order_relaxed);
+
+	m_tail->records[numberOfRecords] = {m_lineBegin, m_tail->size - m_lineBegin};
+	m_tail->numberOfRecords.store(numberOfRecords + 1, std::memory_order_release);
+
+	m_lineBegin = m_tail->size;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
@@ -1,5 +1,7 @@
 #include <ginkgo/utils/Utils.h>
 
+#include <csignal>
+#include <mutex>
 #include <sstream>
 #include <algorithm>
 #include <cstring>
@@ -64,4 +66,16 @@ bool isAlphanumeric(char c)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void ignoreBrokenPipes()
+{
+	static std::once_flag onceFlag;
+
+	std::call_once(onceFlag, []()
+	{
+		signal(SIGPIPE, SIG_IGN);
+	});
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 }
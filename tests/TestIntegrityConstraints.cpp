@@ -1,7 +1,17 @@
 #include <catch.hpp>
 
+#include <ginkgo/solving/ClingoSolver.h>
 #include <ginkgo/solving/Constraint.h>
 #include <ginkgo/solving/GeneralizedConstraint.h>
+#include <ginkgo/solving/GroundProgram.h>
+
+#include <ginkgo/feedback-loop/production/CounterexampleStore.h>
+#include <ginkgo/feedback-loop/production/FeedbackLoop.h>
+#include <ginkgo/feedback-loop/production/ProofCache.h>
+#include <ginkgo/feedback-loop/production/RelevanceAnalysis.h>
+#include <ginkgo/feedback-loop/production/Simulator.h>
+
+#include <ginkgo/utils/LineQueue.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -89,6 +99,9 @@ TEST_CASE("Literals are eliminated as specified", "[constraints]")
 
 	REQUIRE(b.withoutLiterals(0)->subsumes(c));
 	REQUIRE(c.subsumes(*b.withoutLiterals(0)));
+
+	REQUIRE(a.withLiterals({1, 2, 4})->subsumes(c));
+	REQUIRE(c.subsumes(*a.withLiterals({1, 2, 4})));
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,3 +244,502 @@ TEST_CASE("Generalized constraint subsumption works with actions", "[constraints
 	REQUIRE(generalizedA.subsumes(c));
 	REQUIRE_FALSE(generalizedA.subsumes(d));
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Proof results are cached for time-shifted and reordered hypotheses", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+
+	ginkgo::SymbolTable symbolTable;
+
+	auto a = std::make_shared<ginkgo::Constraint>(0, ":- holds(a, 1), holds(b, 2).", symbolTable);
+	auto b = std::make_shared<ginkgo::Constraint>(0, ":- holds(b, 6), holds(a, 5).", symbolTable);
+	auto c = std::make_shared<ginkgo::Constraint>(0, ":- holds(a, 1), holds(b, 3).", symbolTable);
+
+	ProofCache proofCache;
+	auto proofResult = ProofResult::Unknown;
+
+	proofCache.insert(ginkgo::GeneralizedConstraint(a), ProofMethod::StateWiseProof, 0, ProofResult::Unproven);
+
+	REQUIRE(proofCache.find(ginkgo::GeneralizedConstraint(b), ProofMethod::StateWiseProof, 0, proofResult));
+	REQUIRE(proofResult == ProofResult::Unproven);
+	REQUIRE_FALSE(proofCache.find(ginkgo::GeneralizedConstraint(c), ProofMethod::StateWiseProof, 0, proofResult));
+	REQUIRE_FALSE(proofCache.find(ginkgo::GeneralizedConstraint(b), ProofMethod::InductionProof, 0, proofResult));
+
+	// Only proven results remain valid after learning further constraints
+	REQUIRE_FALSE(proofCache.find(ginkgo::GeneralizedConstraint(b), ProofMethod::StateWiseProof, 1, proofResult));
+
+	proofCache.insert(ginkgo::GeneralizedConstraint(c), ProofMethod::StateWiseProof, 0, ProofResult::Proven);
+
+	REQUIRE(proofCache.find(ginkgo::GeneralizedConstraint(c), ProofMethod::StateWiseProof, 1, proofResult));
+	REQUIRE(proofResult == ProofResult::Proven);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Hypotheses are refuted by counterexamples of earlier proofs", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+
+	ginkgo::SymbolTable symbolTable;
+
+	const auto hypothesis = [&](const std::string &string)
+	{
+		return ginkgo::GeneralizedConstraint(std::make_shared<ginkgo::Constraint>(0, string, symbolTable));
+	};
+
+	CounterexampleStore counterexampleStore(symbolTable);
+	counterexampleStore.insert({false, 2,
+		{"holds(a,0)", "holds(b,0)", "apply(x,1)", "del(a,1)", "holds(b,1)", "apply(y,2)", "holds(b,2)", "holds(c,2)"}});
+
+	REQUIRE(counterexampleStore.size() == 1);
+
+	REQUIRE(counterexampleStore.refutes(hypothesis(":- holds(b, 5), not holds(a, 6)."), ProofMethod::StateWiseProof));
+	REQUIRE(counterexampleStore.refutes(hypothesis(":- holds(b, 3), apply(y, 4)."), ProofMethod::StateWiseProof));
+	REQUIRE_FALSE(counterexampleStore.refutes(hypothesis(":- holds(a, 3), holds(c, 3)."), ProofMethod::StateWiseProof));
+	REQUIRE_FALSE(counterexampleStore.refutes(hypothesis(":- holds(b, 2), holds(c, 5)."), ProofMethod::StateWiseProof));
+	REQUIRE_FALSE(counterexampleStore.refutes(hypothesis(":- not holds(b, 3), apply(y, 4)."), ProofMethod::StateWiseProof));
+
+	// Only the induction step is refuted by traces not starting in the initial state
+	REQUIRE(counterexampleStore.refutes(hypothesis(":- holds(c, 1)."), ProofMethod::InductionProof));
+	REQUIRE_FALSE(counterexampleStore.refutes(hypothesis(":- holds(b, 5), not holds(a, 6)."), ProofMethod::InductionProof));
+	REQUIRE_FALSE(counterexampleStore.refutes(hypothesis(":- holds(b, 5), not holds(a, 6)."), ProofMethod::Portfolio));
+
+	// Traces violating learned constraints are dropped
+	counterexampleStore.addLearnedConstraint(*hypothesis(":- holds(c, 0).").originalConstraint());
+
+	REQUIRE(counterexampleStore.size() == 0);
+	REQUIRE_FALSE(counterexampleStore.refutes(hypothesis(":- holds(b, 5), not holds(a, 6)."), ProofMethod::StateWiseProof));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Hypotheses are refuted by simulated traces", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+
+	ginkgo::SymbolTable symbolTable;
+
+	const auto hypothesis = [&](const std::string &string)
+	{
+		return ginkgo::GeneralizedConstraint(std::make_shared<ginkgo::Constraint>(0, string, symbolTable));
+	};
+
+	const Simulator simulator({"init(a)", "action(x)", "demands(x,a,true)", "adds(x,b)", "deletes(x,a)",
+		"action(y)", "demands(y,b,true)", "adds(y,a)", "deletes(y,b)", "adds(z,c)"}, symbolTable);
+
+	REQUIRE(simulator.numberOfFluents() == 2);
+	REQUIRE(simulator.numberOfActions() == 2);
+
+	std::mt19937 generator(0);
+
+	CounterexampleStore simulatedTraces(symbolTable);
+
+	for (const auto &trace : simulator.exploreBreadthFirst(3, 4))
+		simulatedTraces.insert(trace);
+
+	REQUIRE(simulatedTraces.refutes(hypothesis(":- holds(a, 2), apply(x, 3), holds(b, 3)."), ProofMethod::InductionProof));
+	REQUIRE_FALSE(simulatedTraces.refutes(hypothesis(":- holds(a, 1), holds(b, 1)."), ProofMethod::StateWiseProof));
+
+	// States over the fluent closure need not be reachable
+	for (const auto &trace : simulator.walkFromFluentClosure(3, 64, generator))
+		simulatedTraces.insert(trace);
+
+	REQUIRE(simulatedTraces.refutes(hypothesis(":- holds(a, 1), holds(b, 1)."), ProofMethod::StateWiseProof));
+	REQUIRE_FALSE(simulatedTraces.refutes(hypothesis(":- holds(a, 1), holds(b, 1)."), ProofMethod::InductionProof));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("State-wise proofs of low degree are decided explicitly", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+
+	ginkgo::SymbolTable symbolTable;
+
+	const auto constraint = [&](const std::string &string)
+	{
+		return std::make_shared<ginkgo::Constraint>(0, string, symbolTable);
+	};
+
+	const Simulator simulator({"fluent(a)", "fluent(b)", "init(a)", "action(x)", "demands(x,a,true)", "adds(x,b)",
+		"deletes(x,a)", "action(y)", "demands(y,b,true)", "adds(y,a)", "deletes(y,b)"}, symbolTable);
+
+	ginkgo::Constraints learnedConstraints(symbolTable);
+
+	const auto check = [&](const std::string &hypothesis, size_t maxStates = 64)
+	{
+		auto proofResult = ProofResult::Unknown;
+
+		if (!simulator.checkStateWiseProof(*constraint(hypothesis), learnedConstraints,
+			FluentClosureUsage::NoFluentClosure, maxStates, proofResult))
+		{
+			return ProofResult::Unknown;
+		}
+
+		return proofResult;
+	};
+
+	REQUIRE(check(":- holds(a, 0), holds(b, 0).") == ProofResult::Unproven);
+	REQUIRE(check(":- apply(x, 1), holds(a, 1).") == ProofResult::Proven);
+	REQUIRE(check(":- apply(x, 1), holds(b, 1).") == ProofResult::Unproven);
+	REQUIRE(check(":- holds(c, 0).") == ProofResult::Proven);
+	REQUIRE(check(":- apply(y, 1).") == ProofResult::Unproven);
+
+	// Higher degrees and too large state spaces are left to the solver
+	REQUIRE(check(":- holds(a, 0), holds(b, 2).") == ProofResult::Unknown);
+	REQUIRE(check(":- holds(a, 0), holds(b, 0).", 2) == ProofResult::Unknown);
+
+	learnedConstraints.push_back(constraint(":- holds(b, 0)."));
+
+	REQUIRE(check(":- apply(y, 1).") == ProofResult::Proven);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Explicit-state checks agree with state-wise proofs over the fluent closure", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+
+	ginkgo::SymbolTable symbolTable;
+
+	// d is not part of the fluent closure, so z is never applicable, and y has a negative demand
+	const std::vector<std::string> facts = {"fluent(a)", "fluent(b)", "fluent(c)", "fluent(d)", "init(a)",
+		"action(x)", "demands(x,a,true)", "adds(x,b)", "deletes(x,a)",
+		"action(y)", "demands(y,b,true)", "demands(y,c,false)", "adds(y,c)",
+		"action(z)", "demands(z,d,true)", "adds(z,a)"};
+
+	const Simulator simulator(facts, symbolTable);
+
+	ginkgo::Constraints learnedConstraints(symbolTable);
+
+	const auto prove = [&](const ginkgo::GeneralizedConstraint &hypothesis)
+	{
+		std::stringstream program;
+
+		for (const auto &fact : facts)
+			program << fact << "." << std::endl;
+
+		program
+			<< FeedbackLoop::FluentClosureEncoding
+			<< "#const degree=" << hypothesis.degree() << "." << std::endl
+			<< FeedbackLoop::StateWiseProofEncoding
+			<< "hypothesisConstraint(T) " << hypothesis << std::endl
+			<< FeedbackLoop::StateWiseProofCheckEncoding;
+
+		for (const auto &learnedConstraint : learnedConstraints)
+		{
+			ginkgo::GeneralizedConstraint(learnedConstraint).print(program);
+			program << std::endl;
+		}
+
+		ginkgo::ClingoSolver solver;
+
+		bool groundingTimeout = false;
+		bool solvingTimeout = false;
+
+		const auto satisfiability = solver.solve(program.str(), std::chrono::milliseconds(0), groundingTimeout, solvingTimeout);
+
+		return (satisfiability == ginkgo::Satisfiability::Unsatisfiable) ? ProofResult::Proven : ProofResult::Unproven;
+	};
+
+	std::vector<std::string> literals;
+
+	for (const auto &fluent : {"a", "b", "c", "d"})
+		for (const auto &time : {"0", "1"})
+		{
+			literals.push_back(std::string("holds(") + fluent + ", " + time + ")");
+			literals.push_back(std::string("not holds(") + fluent + ", " + time + ")");
+		}
+
+	for (const auto &action : {"x", "y", "z"})
+	{
+		literals.push_back(std::string("apply(") + action + ", 1)");
+		literals.push_back(std::string("not apply(") + action + ", 1)");
+	}
+
+	const auto compare = [&]()
+	{
+		for (size_t i = 0; i < literals.size(); i++)
+			for (size_t j = i + 1; j < literals.size(); j++)
+			{
+				const auto hypothesis = std::make_shared<ginkgo::Constraint>(0,
+					":- " + literals[i] + ", " + literals[j] + ".", symbolTable);
+
+				// Only hypotheses of degree 1 are decided with transitions
+				if (hypothesis->numberOfLiterals() != 2 || hypothesis->timeRange() != std::make_tuple(size_t(0), size_t(1)))
+				{
+					continue;
+				}
+
+				auto proofResult = ProofResult::Unknown;
+
+				REQUIRE(simulator.checkStateWiseProof(*hypothesis, learnedConstraints,
+					FluentClosureUsage::UseFluentClosure, 1024, proofResult));
+
+				REQUIRE(proofResult == prove(ginkgo::GeneralizedConstraint(hypothesis)));
+			}
+	};
+
+	compare();
+
+	learnedConstraints.push_back(std::make_shared<ginkgo::Constraint>(0, ":- holds(b, 0), holds(c, 0).", symbolTable));
+
+	compare();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Instances are reduced to reachable actions and fluents", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+
+	ginkgo::SymbolTable symbolTable;
+
+	const RelevanceAnalysis relevanceAnalysis({"init(a)", "init(s)", "goal(b,true)",
+		"action(x)", "demands(x,a,true)", "demands(x,s,true)", "adds(x,b)", "deletes(x,a)",
+		"action(y)", "demands(y,c,true)", "adds(y,d)",
+		"action(w)", "demands(w,s,false)", "adds(w,c)"}, symbolTable);
+
+	REQUIRE(relevanceAnalysis.numberOfFluents() == 5);
+	REQUIRE(relevanceAnalysis.numberOfReachableFluents() == 3);
+	REQUIRE(relevanceAnalysis.numberOfStaticFluents() == 3);
+	REQUIRE(relevanceAnalysis.numberOfActions() == 3);
+	REQUIRE(relevanceAnalysis.numberOfReachableActions() == 1);
+	REQUIRE(relevanceAnalysis.numberOfFacts() == 14);
+	REQUIRE(relevanceAnalysis.numberOfReducedFacts() == 7);
+
+	const auto reducedProgram = relevanceAnalysis.reducedProgram();
+
+	REQUIRE(reducedProgram.find("demands(x,a,true).") != std::string::npos);
+	REQUIRE(reducedProgram.find("demands(x,s,true).") == std::string::npos);
+	REQUIRE(reducedProgram.find("action(w).") == std::string::npos);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Constraint lines are passed through the line queue", "[constraints]")
+{
+	ginkgo::LineQueue lineQueue;
+	boost::string_ref line;
+
+	REQUIRE(lineQueue.append(":- a, ", 6) == 0);
+	REQUIRE(!lineQueue.pop(line));
+	REQUIRE(lineQueue.append("b.\n\n:- c", 8) == 2);
+
+	REQUIRE(lineQueue.pop(line));
+	REQUIRE(line == ":- a, b.");
+	REQUIRE(lineQueue.pop(line));
+	REQUIRE(line.empty());
+	REQUIRE(!lineQueue.pop(line));
+
+	// Unterminated lines are kept when chunks run out of records or memory
+	for (size_t i = 0; i < 10000; i++)
+		lineQueue.append("\n", 1);
+
+	const std::string longLine(3 * 1024 * 1024, 'x');
+	lineQueue.append(longLine.data(), longLine.size());
+	REQUIRE(lineQueue.flush());
+
+	REQUIRE(lineQueue.pop(line));
+	REQUIRE(line == ":- c");
+
+	size_t numberOfLines = 0;
+
+	while (lineQueue.pop(line) && line.empty())
+		numberOfLines++;
+
+	REQUIRE(numberOfLines == 9999);
+	REQUIRE(line == longLine);
+	REQUIRE(!lineQueue.pop(line));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Constraints are filtered while parsing", "[constraints]")
+{
+	using FilterResult = ginkgo::Constraint::FilterResult;
+
+	ginkgo::SymbolTable symbolTable;
+	const ginkgo::ConstraintFilter filter = {2, 3, "terminal"};
+	FilterResult filterResult;
+
+	auto constraint = ginkgo::Constraint::parse(0, ":- holds(a,1), terminal(2), holds(a,1), apply(b,2).  %lbd=4", symbolTable, filter, filterResult);
+	REQUIRE(filterResult == FilterResult::Accepted);
+	REQUIRE(constraint->numberOfLiterals() == 2);
+	REQUIRE(!constraint->containsIdentifier("terminal"));
+	REQUIRE(constraint->lbd() == 4);
+
+	// Degree is checked before the number of literals, even when the latter is exceeded first
+	constraint = ginkgo::Constraint::parse(0, ":- holds(a,3), holds(b,3), holds(c,3), holds(d,3), holds(e,9).", symbolTable, filter, filterResult);
+	REQUIRE(!constraint);
+	REQUIRE(filterResult == FilterResult::DegreeTooHigh);
+
+	constraint = ginkgo::Constraint::parse(0, ":- holds(a,3), holds(b,3), terminal(3), holds(d,4).", symbolTable, filter, filterResult);
+	REQUIRE(!constraint);
+	REQUIRE(filterResult == FilterResult::ContainsTooManyLiterals);
+
+	constraint = ginkgo::Constraint::parse(0, ":- terminal(3).", symbolTable, filter, filterResult);
+	REQUIRE(!constraint);
+	REQUIRE(filterResult == FilterResult::Empty);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Constraints rejected while parsing are reported as before", "[constraints]")
+{
+	using namespace ginkgo::feedbackLoop::production;
+	using Reason = EventConstraintsRemoved::Reason;
+
+	ginkgo::SymbolTable symbolTable;
+	const ginkgo::ConstraintFilter filter = {2, 3, "terminal"};
+
+	const std::vector<std::string> lines =
+	{
+		":- holds(a,1), terminal(2).",
+		":- terminal(1).",
+		":- terminal(0), terminal(2).",
+		":- holds(a,0), holds(b,5).",
+		":- holds(a,0), holds(b,0), holds(c,0), holds(d,0).",
+		":- holds(a,0), holds(b,1)."
+	};
+
+	std::map<ginkgo::Constraint::FilterResult, size_t> rejectedFeedback;
+
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		ginkgo::Constraint::FilterResult filterResult;
+
+		if (!ginkgo::Constraint::parse(i, lines[i], symbolTable, filter, filterResult))
+			rejectedFeedback[filterResult]++;
+	}
+
+	REQUIRE(rejectedFeedback[ginkgo::Constraint::FilterResult::Empty] == 2);
+
+	Events events;
+	// The empty constraints remain to be counted as subsumed
+	REQUIRE(FeedbackLoop::notifyRejectedFeedback(rejectedFeedback, lines.size(), events) == 4);
+
+	const auto &eventsConstraintsRemoved = events.eventsConstraintsRemoved();
+	REQUIRE(eventsConstraintsRemoved.size() == 2);
+
+	const auto requireEvent = [&](size_t index, Reason reason, size_t removedConstraints, size_t remainingConstraints)
+	{
+		const auto &event = std::get<1>(eventsConstraintsRemoved[index]);
+		REQUIRE(event.reason == reason);
+		REQUIRE(event.removedConstraints == removedConstraints);
+		REQUIRE(event.remainingConstraints == remainingConstraints);
+	};
+
+	requireEvent(0, Reason::DegreeTooHigh, 1, 5);
+	requireEvent(1, Reason::ContainsTooManyLiterals, 1, 4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Identifiers are interned as dense symbols", "[constraints]")
+{
+	ginkgo::SymbolTable symbolTable;
+
+	const auto a = symbolTable.symbol("a");
+	const auto &name = symbolTable.name(a);
+
+	// Grow the table well beyond its initial number of slots
+	for (size_t i = 0; i < 10000; i++)
+		REQUIRE(symbolTable.symbol(std::to_string(i)) == i + 1);
+
+	REQUIRE(symbolTable.size() == 10001);
+	REQUIRE(symbolTable.symbol("a") == a);
+	REQUIRE(symbolTable.symbol("5000") == 5001);
+	REQUIRE(&symbolTable.name(a) == &name);
+	REQUIRE(symbolTable.name(5001) == "5000");
+
+	ginkgo::Constraint b(0, ":- holds(on(a,b),1), not apply(move(a,b),2).", symbolTable);
+	ginkgo::Constraint c(0, ":- not apply(move(a,b),2), holds(on(a,b),1).", symbolTable);
+	ginkgo::Constraint d(0, ":- holds(on(a,b),1), apply(move(a,b),2).", symbolTable);
+
+	REQUIRE(b == c);
+	REQUIRE(b.hash() == c.hash());
+	REQUIRE(b != d);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Equal terms are stored once", "[constraints]")
+{
+	ginkgo::SymbolTable symbolTable;
+
+	ginkgo::Constraint a(0, ":- holds(on(a,(b,c)),1), not holds(on(a,(b,c)),2).", symbolTable);
+	ginkgo::Constraint b(1, ":- not holds(on(a,(b,c)),1).", symbolTable);
+
+	const auto &aLiterals = a.literals();
+	const auto &bLiterals = b.literals();
+
+	REQUIRE(aLiterals[0].term() == bLiterals[0].term());
+	REQUIRE(aLiterals[0] != bLiterals[0]);
+	REQUIRE(aLiterals[0].term()->arguments[0] == aLiterals[1].term()->arguments[0]);
+	REQUIRE(aLiterals[1].equalsShifted(bLiterals[0], -1));
+	REQUIRE(!aLiterals[0].equalsShifted(aLiterals[1], 1));
+	REQUIRE(aLiterals[1].timeArgument() == 2);
+
+	// holds(on(a,(b,c))) without time arguments, on(a,(b,c)), a, b, c, and the time steps 1 and 2
+	REQUIRE(symbolTable.numberOfTerms() == 7);
+	REQUIRE(aLiterals[0].term() == aLiterals[1].term());
+	REQUIRE(aLiterals[1].hashWithoutTime() == bLiterals[0].hashWithoutTime());
+	REQUIRE(bLiterals[0].normalized(1) == aLiterals[1]);
+	REQUIRE(std::is_trivially_copyable<ginkgo::Literal>::value);
+
+	std::stringstream output;
+	output << b;
+	REQUIRE(output.str() == ":- not holds(on(a, b, c), 1).");
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Separately grounded programs are appended to ground programs by their shown atoms", "[constraints]")
+{
+	// {holds(a,0)}. holds(b,0) :- holds(a,0). holds(c,0).
+	const std::string transitionSystem =
+		"asp 1 0 0\n"
+		"1 1 1 1 0 0\n"
+		"1 0 1 2 0 1 1\n"
+		"4 10 holds(a,0) 1 1\n"
+		"4 10 holds(b,0) 1 2\n"
+		"4 10 holds(c,0) 0\n"
+		"0\n";
+
+	ginkgo::GroundProgram groundProgram;
+	REQUIRE(!groundProgram.read("holds(a,0).\n"));
+	REQUIRE(groundProgram.read(transitionSystem));
+
+	REQUIRE(*groundProgram.interfaceEncoding() ==
+		"#external holds(a,0).\n"
+		"#show holds(a,0) : holds(a,0).\n"
+		"#external holds(b,0).\n"
+		"#show holds(b,0) : holds(b,0).\n"
+		"holds(c,0).\n");
+
+	// hypothesisConstraint(0) :- holds(b,0), not holds(a,0). :- not hypothesisConstraint(0).
+	const std::string proof =
+		"asp 1 0 0\n"
+		"5 2 2\n"
+		"5 1 2\n"
+		"1 0 1 3 0 2 1 -2\n"
+		"1 0 0 0 1 -3\n"
+		"4 10 holds(a,0) 1 2\n"
+		"4 10 holds(b,0) 1 1\n"
+		"4 10 holds(c,0) 0\n"
+		"0\n";
+
+	ginkgo::Encoding linkedProgram;
+	REQUIRE(groundProgram.append(proof, linkedProgram));
+	REQUIRE(linkedProgram.str() == transitionSystem.substr(0, transitionSystem.size() - 2)
+		+ "1 0 1 5 0 2 2 -1\n"
+		"1 0 0 0 1 -5\n"
+		"0\n");
+
+	// Atoms of the ground program must not be redefined
+	ginkgo::Encoding invalidProgram;
+	REQUIRE(!groundProgram.append("asp 1 0 0\n1 0 1 1 0 0\n4 10 holds(b,0) 1 1\n0\n", invalidProgram));
+}